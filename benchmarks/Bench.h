@@ -0,0 +1,57 @@
+//
+// Created by Ivor_Aif on 2026/10/18.
+//
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+
+// Small helpers shared by the standalone benchmarks in this directory.
+namespace bench {
+
+struct Xorshift {
+    std::uint64_t state;
+
+    std::uint64_t operator()() noexcept {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+class Stopwatch {
+private:
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+public:
+    void reset() noexcept {
+        start = std::chrono::steady_clock::now();
+    }
+
+    [[nodiscard]] double seconds() const noexcept {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    [[nodiscard]] double millis() const noexcept {
+        return seconds() * 1e3;
+    }
+};
+
+// Keeps `value` alive as far as the optimizer is concerned.
+template<typename T>
+void keep(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// `argv[index]` as a number, or `fallback` when it was not given.
+inline size_t arg(const int argc, char** argv, const int index, const size_t fallback) {
+    return argc > index ? std::strtoull(argv[index], nullptr, 10) : fallback;
+}
+
+}
+
+#endif // BENCH_H
@@ -0,0 +1,111 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../headers/ConcurrentHash.h"
+#include "Bench.h"
+
+// Read-heavy scaling benchmark: every thread runs 90% lookups and 10% insertOrAssign over uniformly
+// random keys of a prefilled table, for a fixed time. `ConcurrentHash` is compared against a single
+// `Hash` behind one global mutex, which is what it replaces.
+//
+// Usage: ConcurrentHashBench [maxThreads = hardware threads, at most 32] [millis per run = 1000]
+
+using namespace mySTL::containers;
+
+namespace {
+
+constexpr size_t keyCount = 1 << 20;
+constexpr unsigned readPercent = 90;
+
+class LockedHash {
+private:
+    mutable std::mutex lock;
+    Hash<std::uint64_t, std::uint64_t> map;
+
+public:
+    bool tryGet(const std::uint64_t key, std::uint64_t& out) const {
+        std::lock_guard guard(lock);
+        auto it = map.find(key);
+        if (it == map.end()) {
+            return false;
+        }
+        out = it->second;
+        return true;
+    }
+
+    void insertOrAssign(const std::uint64_t key, const std::uint64_t value) {
+        std::lock_guard guard(lock);
+        map[key] = value;
+    }
+};
+
+// Runs `threads` workers for `millis` and returns millions of operations per second.
+template<typename Map>
+double run(Map& map, const size_t threads, const unsigned millis) {
+    std::atomic<bool> start(false), stop(false);
+    std::atomic<std::uint64_t> total(0);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            bench::Xorshift rng{ 0x9E3779B97F4A7C15ull * (t + 1) };
+            std::uint64_t ops = 0, sink = 0;
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int i = 0; i < 256; ++i) {
+                    const std::uint64_t r = rng(), key = r % keyCount;
+                    if ((r >> 32) % 100 < readPercent) {
+                        map.tryGet(key, sink);
+                    } else {
+                        map.insertOrAssign(key, r);
+                    }
+                }
+                ops += 256;
+            }
+            total.fetch_add(ops, std::memory_order_relaxed);
+        });
+    }
+    const bench::Stopwatch watch;
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::milliseconds(millis));
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return static_cast<double>(total.load()) / watch.seconds() / 1e6;
+}
+
+}
+
+int main(const int argc, char** argv) {
+    const size_t hardware = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    const size_t maxThreads = bench::arg(argc, argv, 1, std::min<size_t>(hardware, 32));
+    const auto millis = static_cast<unsigned>(bench::arg(argc, argv, 2, 1000));
+
+    ConcurrentHash<std::uint64_t, std::uint64_t> sharded;
+    LockedHash locked;
+    sharded.reserve(keyCount);
+    for (std::uint64_t key = 0; key < keyCount; ++key) {
+        sharded.insert(key, key);
+        locked.insertOrAssign(key, key);
+    }
+
+    std::printf("%zu hardware threads, %zu shards, %zu keys, %u%% reads\n", hardware, sharded.getShardCount(), keyCount, readPercent);
+    std::printf("%8s %16s %10s %16s %10s\n", "threads", "sharded Mops/s", "speedup", "locked Mops/s", "speedup");
+    double shardedBase = 0, lockedBase = 0;
+    for (size_t threads = 1; threads <= maxThreads; threads = threads < maxThreads && threads * 2 > maxThreads ? maxThreads : threads * 2) {
+        const double s = run(sharded, threads, millis), l = run(locked, threads, millis);
+        if (threads == 1) {
+            shardedBase = s;
+            lockedBase = l;
+        }
+        std::printf("%8zu %16.2f %9.2fx %16.2f %9.2fx\n", threads, s, s / shardedBase, l, l / lockedBase);
+    }
+    return 0;
+}
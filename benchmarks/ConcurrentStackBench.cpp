@@ -0,0 +1,109 @@
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../headers/ConcurrentStack.h"
+#include "../headers/Stack.h"
+#include "Bench.h"
+
+// Scaling benchmark: every thread pushes and pops in equal parts for a fixed time, the pattern of a
+// shared free list. `ConcurrentStack` is run plain and with elimination backoff, next to a `Stack`
+// behind one mutex, which is what it replaces. The stacks start with some elements so that pops
+// rarely find them empty.
+//
+// Usage: ConcurrentStackBench [maxThreads = 64] [millis per run = 500]
+
+using namespace mySTL::structures;
+
+namespace {
+
+constexpr long prefill = 1024;
+
+class LockedStack {
+private:
+    std::mutex lock;
+    Stack<long> stack;
+
+public:
+    void push(const long value) {
+        std::lock_guard guard(lock);
+        stack.push(value);
+    }
+
+    bool tryPop(long& out) {
+        std::lock_guard guard(lock);
+        if (stack.empty()) {
+            return false;
+        }
+        out = stack.top();
+        stack.pop();
+        return true;
+    }
+};
+
+// Runs `threads` workers for `millis` and returns millions of operations per second.
+template<typename S>
+double run(const size_t threads, const unsigned millis) {
+    S stack;
+    for (long i = 0; i < prefill; ++i) {
+        stack.push(i);
+    }
+    std::atomic<bool> start(false), stop(false);
+    std::atomic<std::uint64_t> total(0);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            bench::Xorshift rng{ 0x9E3779B97F4A7C15ull * (t + 1) };
+            std::uint64_t ops = 0;
+            long value = 0;
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            while (!stop.load(std::memory_order_relaxed)) {
+                for (int i = 0; i < 64; ++i) {
+                    if (rng() & 1) {
+                        stack.push(value);
+                    } else {
+                        stack.tryPop(value);
+                    }
+                }
+                ops += 64;
+            }
+            total.fetch_add(ops, std::memory_order_relaxed);
+        });
+    }
+    const bench::Stopwatch watch;
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::milliseconds(millis));
+    stop.store(true, std::memory_order_relaxed);
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    return static_cast<double>(total.load()) / watch.seconds() / 1e6;
+}
+
+}
+
+int main(const int argc, char** argv) {
+    const size_t maxThreads = bench::arg(argc, argv, 1, 64);
+    const auto millis = static_cast<unsigned>(bench::arg(argc, argv, 2, 500));
+
+    std::printf("%u hardware threads, 50%% push / 50%% pop, Mops/s (speedup over 1 thread)\n", std::thread::hardware_concurrency());
+    std::printf("%8s %20s %20s %20s\n", "threads", "locked Stack", "ConcurrentStack", "with elimination");
+    double lockedBase = 0, plainBase = 0, elimBase = 0;
+    for (size_t threads = 1; threads <= maxThreads; threads = threads < maxThreads && threads * 2 > maxThreads ? maxThreads : threads * 2) {
+        const double locked = run<LockedStack>(threads, millis);
+        const double plain = run<ConcurrentStack<long>>(threads, millis);
+        const double elim = run<ConcurrentStack<long, true>>(threads, millis);
+        if (threads == 1) {
+            lockedBase = locked;
+            plainBase = plain;
+            elimBase = elim;
+        }
+        std::printf("%8zu %12.2f (%4.2fx) %12.2f (%4.2fx) %12.2f (%4.2fx)\n", threads, locked, locked / lockedBase, plain, plain / plainBase, elim, elim / elimBase);
+    }
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "../headers/Array.h"
+#include "../headers/Hash.h"
+#include "../headers/Hasher.h"
+#include "../headers/String.h"
+#include "Bench.h"
+
+// Collision and throughput benchmark for `Hasher`. First, `hashBytes` against FNV-1a and
+// `std::hash<std::string_view>` over inputs of growing length. Then `Hash<long, long>` filled with
+// strided keys under the identity `std::hash<long>` and under `Hasher<long>`: power-of-two strides
+// pile the identity hash into a few buckets once `Hash` masks off the low bits. Last, the chain
+// shape of `Hash<String, int>` over short numeric strings. The strided run uses fewer keys because
+// the identity hash makes every insert and lookup walk a chain thousands of entries long.
+//
+// Usage: HasherBench [strided keys = 100000] [string keys = 1000000]
+
+using namespace mySTL;
+using namespace mySTL::containers;
+
+namespace {
+
+std::uint64_t fnv1a(const std::string_view view) noexcept {
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    for (const char c : view) {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// Millions of hashes per second over `len`-byte windows that slide through a fixed buffer.
+template<typename Fn>
+double hashRate(const size_t len, Fn fn) {
+    Array<char> buffer;
+    for (size_t i = 0; i < 4096 + len; ++i) {
+        buffer.pushBack(static_cast<char>(i * 131 + (i >> 5)));
+    }
+    const size_t iterations = (size_t(1) << 28) / (len + 8);
+    std::uint64_t sink = 0;
+    const bench::Stopwatch watch;
+    for (size_t i = 0; i < iterations; ++i) {
+        sink += fn(std::string_view(buffer.getData() + (i * 8 & 4095), len));
+    }
+    const double seconds = watch.seconds();
+    bench::keep(sink);
+    return static_cast<double>(iterations) / seconds / 1e6;
+}
+
+template<typename HashFn>
+void chains(const char* name, const long keys, const long stride) {
+    Hash<long, long, HashFn> table;
+    for (long i = 0; i < keys; ++i) {
+        table.emplace(i * stride, i);
+    }
+    const HashStats stats = table.getStats();
+    long found = 0;
+    const bench::Stopwatch watch;
+    for (long i = 0; i < keys; ++i) {
+        found += table.contains(i * stride);
+    }
+    const double millis = watch.millis();
+    bench::keep(found);
+    std::printf("%12s %7ld %10zu %11.2f %11.1f\n", name, stride, stats.maxChain, stats.meanChain, millis);
+}
+
+}
+
+int main(const int argc, char** argv) {
+    const auto strided = static_cast<long>(bench::arg(argc, argv, 1, 100'000));
+    const auto keys = static_cast<long>(bench::arg(argc, argv, 2, 1'000'000));
+
+    std::printf("string hashing, M hashes/s\n");
+    std::printf("%6s %10s %10s %10s\n", "bytes", "FNV-1a", "hashBytes", "std::hash");
+    for (const size_t len : {4, 8, 16, 32, 64, 256, 1024}) {
+        const double fnv = hashRate(len, fnv1a);
+        const double wy = hashRate(len, [](const std::string_view view) { return hash::hashBytes(view); });
+        const double stdHash = hashRate(len, [](const std::string_view view) { return std::hash<std::string_view>{}(view); });
+        std::printf("%6zu %10.1f %10.1f %10.1f\n", len, fnv, wy, stdHash);
+    }
+
+    std::printf("\nHash<long, long> with %ld strided keys\n", strided);
+    std::printf("%12s %7s %10s %11s %11s\n", "hash", "stride", "max chain", "mean chain", "lookups ms");
+    for (const long stride : {1, 64, 4096}) {
+        chains<std::hash<long>>("std::hash", strided, stride);
+        chains<hash::Hasher<long>>("Hasher", strided, stride);
+    }
+
+    Hash<String, int> strings;
+    for (long i = 0; i < keys; ++i) {
+        strings.emplace(String(std::to_string(i * 3).c_str()), 1);
+    }
+    const HashStats stats = strings.getStats();
+    size_t crowded = 0;
+    for (size_t k = 3; k < stats.occupancy.getSize(); ++k) {
+        crowded += stats.occupancy[k];
+    }
+    std::printf("\nHash<String, int> with %ld numeric keys: max chain %zu, mean chain %.3f, %zu buckets with 3 or more\n", keys, stats.maxChain, stats.meanChain, crowded);
+    return 0;
+}
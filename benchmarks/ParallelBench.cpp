@@ -0,0 +1,75 @@
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+#include "../headers/Array.h"
+#include "../headers/Parallel.h"
+#include "Bench.h"
+
+// Scaling benchmark for the algorithms in `Parallel.h`: each one runs over the same random doubles
+// with `setConcurrency` raised one step at a time, so the speedup column shows how much of the work
+// actually spreads out. `sort` includes its merge rounds, which are split across all tasks too.
+//
+// Usage: ParallelBench [elements = 20000000] [maxConcurrency = hardware threads]
+
+using namespace mySTL;
+
+namespace {
+
+using Doubles = containers::Array<double>;
+
+// Best of `repeats` runs of `fn`, in milliseconds; `setup` restores the input before each run.
+template<typename Setup, typename Fn>
+double best(const int repeats, Setup setup, Fn fn) {
+    double fastest = 0;
+    for (int i = 0; i < repeats; ++i) {
+        setup();
+        const bench::Stopwatch watch;
+        fn();
+        const double millis = watch.millis();
+        fastest = i == 0 || millis < fastest ? millis : fastest;
+    }
+    return fastest;
+}
+
+}
+
+int main(const int argc, char** argv) {
+    const size_t nn = bench::arg(argc, argv, 1, 20'000'000);
+    const size_t hardware = std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1;
+    const size_t maxConcurrency = bench::arg(argc, argv, 2, hardware);
+
+    Doubles source, work(nn, 0.0), out(nn, 0.0);
+    source.reserve(nn);
+    bench::Xorshift rng{ 0x9E3779B97F4A7C15ull };
+    for (size_t i = 0; i < nn; ++i) {
+        source.pushBack(static_cast<double>(rng() % 1'000'000));
+    }
+    auto restore = [&] {
+        std::copy(source.begin(), source.end(), work.begin());
+    };
+    auto none = [] {
+
+    };
+
+    std::printf("%zu doubles, %zu hardware threads, best of 3 in ms (speedup over concurrency 1)\n", nn, hardware);
+    std::printf("%11s %17s %17s %17s %17s %17s\n", "concurrency", "reduce", "transform", "inclusiveScan", "sort", "partition");
+    double base[5] = {};
+    for (size_t concurrency = 1; concurrency <= maxConcurrency; ++concurrency) {
+        parallel::setConcurrency(concurrency);
+        const double times[5] = {
+            best(3, none, [&] { bench::keep(parallel::reduce(source, 0.0)); }),
+            best(3, none, [&] { parallel::transform(source, out, [](const double x) { return std::sqrt(x) * 1.5; }); }),
+            best(3, none, [&] { parallel::inclusiveScan(source, out); }),
+            best(3, restore, [&] { parallel::sort(work); }),
+            best(3, restore, [&] { bench::keep(parallel::partition(work, [](const double x) { return x < 500'000; })); }),
+        };
+        std::printf("%11zu", concurrency);
+        for (int i = 0; i < 5; ++i) {
+            base[i] = concurrency == 1 ? times[i] : base[i];
+            std::printf(" %9.1f (%4.2fx)", times[i], base[i] / times[i]);
+        }
+        std::printf("\n");
+    }
+    return 0;
+}
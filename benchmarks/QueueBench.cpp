@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../headers/ConcurrentQueue.h"
+#include "../headers/Queue.h"
+#include "Bench.h"
+
+// Throughput and latency of `SpscQueue` and `MpmcQueue` against a `Queue` behind one mutex, which is
+// what they replace. All three are bounded to the same capacity and spin with yield when full or
+// empty.
+//
+// Throughput: `items` longs pushed by P producers and popped by C consumers, in millions per second.
+// Latency: one element bounced between two threads through a pair of queues; the round trips are
+// timed one by one and reported as median and 99th percentile.
+//
+// Usage: QueueBench [items = 10000000] [threads per side for the MPMC run = 4] [round trips = 100000]
+
+using namespace mySTL::structures;
+
+namespace {
+
+constexpr size_t capacity = 1024;
+
+class LockedQueue {
+private:
+    std::mutex lock;
+    Queue<long> queue;
+
+public:
+    explicit LockedQueue(size_t) {
+
+    }
+
+    bool tryPush(const long value) {
+        std::lock_guard guard(lock);
+        if (queue.getSize() >= capacity) {
+            return false;
+        }
+        queue.push(value);
+        return true;
+    }
+
+    bool tryPop(long& out) {
+        std::lock_guard guard(lock);
+        if (queue.empty()) {
+            return false;
+        }
+        out = queue.front();
+        queue.pop();
+        return true;
+    }
+};
+
+template<typename Q>
+double throughput(const size_t producers, const size_t consumers, const long items) {
+    Q queue(capacity);
+    std::atomic<long> popped(0);
+    std::vector<std::thread> threads;
+    const bench::Stopwatch watch;
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (long i = static_cast<long>(p); i < items; i += static_cast<long>(producers)) {
+                while (!queue.tryPush(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            long value;
+            while (popped.load(std::memory_order_relaxed) < items) {
+                if (queue.tryPop(value)) {
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return static_cast<double>(items) / watch.seconds() / 1e6;
+}
+
+struct Latency {
+    double median, p99;
+};
+
+template<typename Q>
+Latency roundTrip(const size_t trips) {
+    Q there(capacity), back(capacity);
+    std::thread echo([&] {
+        long value;
+        for (size_t i = 0; i < trips; ++i) {
+            while (!there.tryPop(value)) {
+                std::this_thread::yield();
+            }
+            while (!back.tryPush(value)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    std::vector<double> nanos(trips);
+    long value;
+    for (size_t i = 0; i < trips; ++i) {
+        const bench::Stopwatch watch;
+        while (!there.tryPush(static_cast<long>(i))) {
+            std::this_thread::yield();
+        }
+        while (!back.tryPop(value)) {
+            std::this_thread::yield();
+        }
+        nanos[i] = watch.seconds() * 1e9;
+    }
+    echo.join();
+    std::sort(nanos.begin(), nanos.end());
+    return { nanos[trips / 2], nanos[trips * 99 / 100] };
+}
+
+}
+
+int main(const int argc, char** argv) {
+    const auto items = static_cast<long>(bench::arg(argc, argv, 1, 10000000));
+    const size_t side = std::max<size_t>(bench::arg(argc, argv, 2, 4), 1);
+    const size_t trips = std::max<size_t>(bench::arg(argc, argv, 3, 100000), 1);
+
+    std::printf("%u hardware threads, capacity %zu, %ld items\n", std::thread::hardware_concurrency(), capacity, items);
+    const double spsc1 = throughput<SpscQueue<long>>(1, 1, items), mpmc1 = throughput<MpmcQueue<long>>(1, 1, items), locked1 = throughput<LockedQueue>(1, 1, items);
+    const double mpmcN = throughput<MpmcQueue<long>>(side, side, items), lockedN = throughput<LockedQueue>(side, side, items);
+    std::printf("throughput, Mitems/s\n");
+    const std::string many = std::to_string(side) + "P/" + std::to_string(side) + "C";
+    std::printf("  %-7s SpscQueue %8.2f   MpmcQueue %8.2f   locked Queue %8.2f\n", "1P/1C", spsc1, mpmc1, locked1);
+    std::printf("  %-7s %21sMpmcQueue %8.2f   locked Queue %8.2f\n", many.c_str(), "", mpmcN, lockedN);
+    std::printf("round trip, ns (median / p99)\n");
+    const Latency spsc = roundTrip<SpscQueue<long>>(trips), mpmc = roundTrip<MpmcQueue<long>>(trips), locked = roundTrip<LockedQueue>(trips);
+    std::printf("  SpscQueue %.0f / %.0f   MpmcQueue %.0f / %.0f   locked Queue %.0f / %.0f\n", spsc.median, spsc.p99, mpmc.median, mpmc.p99, locked.median, locked.p99);
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <cstdio>
+
+#include "../headers/Array.h"
+#include "../headers/Queue.h"
+#include "Bench.h"
+
+// Fill-and-drain benchmark for `Queue`: pushes N ints, then empties the queue once with `pop()` and
+// once with `popN`. For reference it also drains a few smaller sizes through `ShiftQueue`, which
+// pops the way `Queue` did before it became a ring buffer, by moving every remaining element down
+// one slot. Its time grows with the square of the size, so it is only run where that stays short.
+//
+// Usage: QueueDrainBench [elements = 10000000] [largest shifting drain = 200000]
+
+using namespace mySTL;
+
+namespace {
+
+class ShiftQueue {
+private:
+    containers::Array<int> data;
+
+public:
+    [[nodiscard]] bool empty() const noexcept {
+        return data.empty();
+    }
+
+    void push(const int value) {
+        data.pushBack(value);
+    }
+
+    int& front() noexcept {
+        return data[0];
+    }
+
+    void pop() noexcept {
+        const size_t size = data.getSize();
+        for (size_t i = 1; i < size; ++i) {
+            data[i - 1] = data[i];
+        }
+        data.popBack();
+    }
+};
+
+template<typename Q>
+void fill(Q& queue, const size_t nn) {
+    for (size_t i = 0; i < nn; ++i) {
+        queue.push(static_cast<int>(i));
+    }
+}
+
+// Milliseconds to pop every element off `queue` one at a time.
+template<typename Q>
+double drain(Q& queue) {
+    long long sum = 0;
+    const bench::Stopwatch watch;
+    while (!queue.empty()) {
+        sum += queue.front();
+        queue.pop();
+    }
+    const double millis = watch.millis();
+    bench::keep(sum);
+    return millis;
+}
+
+}
+
+int main(const int argc, char** argv) {
+    const size_t nn = bench::arg(argc, argv, 1, 10'000'000);
+    const size_t shiftLimit = bench::arg(argc, argv, 2, 200'000);
+
+    structures::Queue<int> queue;
+    bench::Stopwatch watch;
+    fill(queue, nn);
+    const double push = watch.millis();
+    const double pop = drain(queue);
+
+    fill(queue, nn);
+    int buffer[1024];
+    long long sum = 0;
+    watch.reset();
+    for (size_t got; (got = queue.popN(1024, buffer)) != 0;) {
+        for (size_t i = 0; i < got; ++i) {
+            sum += buffer[i];
+        }
+    }
+    const double popN = watch.millis();
+    bench::keep(sum);
+
+    std::printf("Queue<int>, %zu elements: push %.1f ms, drain with pop() %.1f ms, drain with popN(1024) %.1f ms\n", nn, push, pop, popN);
+    for (size_t size = shiftLimit / 4; size != 0 && size <= shiftLimit; size *= 2) {
+        ShiftQueue shifting;
+        fill(shifting, size);
+        const double shifted = drain(shifting);
+        fill(queue, size);
+        const double ring = drain(queue);
+        std::printf("%zu elements: shifting drain %.1f ms, Queue drain %.2f ms\n", size, shifted, ring);
+    }
+    return 0;
+}
@@ -0,0 +1,64 @@
+#include <cstdio>
+
+#include "../headers/Hash.h"
+#include "Bench.h"
+
+// Growth benchmark for `Hash`: inserts N long -> long pairs into a table that starts at 16 buckets
+// and doubles whenever the next insert would push the load factor past 1. Each doubling is timed
+// separately. It runs once with `rehash`, which relinks the existing nodes, and once with a
+// copying rehash that rebuilds the table into fresh nodes, which is how `rehash` used to work.
+//
+// Usage: RehashBench [inserts = 10000000]
+
+using namespace mySTL::containers;
+
+namespace {
+
+using Table = Hash<long, long>;
+
+struct Result {
+    double total, rehash;
+    size_t size;
+};
+
+void relink(Table& table) {
+    table.rehash(table.getBucketCount() * 2);
+}
+
+void copy(Table& table) {
+    Table grown(table.getBucketCount() * 2);
+    for (const auto& entry : table) {
+        grown.insert(entry);
+    }
+    table.swap(grown);
+}
+
+template<typename Grow>
+Result run(const long inserts, Grow grow) {
+    Table table;
+    double rehash = 0;
+    const bench::Stopwatch watch;
+    for (long i = 0; i < inserts; ++i) {
+        if (table.getSize() + 1 > table.getBucketCount()) {
+            const bench::Stopwatch step;
+            grow(table);
+            rehash += step.millis();
+        }
+        table.insert({i * 7919, i});
+    }
+    return { watch.millis(), rehash, table.getSize() };
+}
+
+}
+
+int main(const int argc, char** argv) {
+    const auto inserts = static_cast<long>(bench::arg(argc, argv, 1, 10'000'000));
+
+    std::printf("%ld inserts, doubling from 16 buckets, ms\n", inserts);
+    std::printf("%16s %10s %10s\n", "", "total", "rehash");
+    const Result relinked = run(inserts, relink);
+    std::printf("%16s %10.0f %10.0f\n", "relinking nodes", relinked.total, relinked.rehash);
+    const Result copied = run(inserts, copy);
+    std::printf("%16s %10.0f %10.0f\n", "copying nodes", copied.total, copied.rehash);
+    return relinked.size == copied.size ? 0 : 1;
+}
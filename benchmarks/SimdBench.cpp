@@ -0,0 +1,85 @@
+#include <cstdio>
+
+#include "../headers/Array.h"
+#include "../headers/Simd.h"
+#include "Bench.h"
+
+// Microbenchmark of the `Array` search and reduction kernels against the scalar loops in Simd.h
+// that they fall back to. Each kernel scans the whole array: searches look for a value that is not
+// there. The scalar loops are built with the same flags, so where the compiler vectorizes them on
+// its own (often integer count, min and max) the gap narrows.
+//
+// Usage: SimdBench [elements = 10000000] [repeats = 50]
+
+using namespace mySTL::containers;
+
+namespace {
+
+int repeats = 50;
+
+// Mean milliseconds per call of `fn`, whose result is kept alive.
+template<typename Fn>
+double timed(Fn fn) {
+    const bench::Stopwatch watch;
+    for (int r = 0; r < repeats; ++r) {
+        bench::keep(fn());
+    }
+    return watch.millis() / repeats;
+}
+
+template<typename Scalar, typename Simd>
+void row(const char* name, Scalar scalar, Simd simd) {
+    const double scalarMillis = timed(scalar);
+    const double simdMillis = timed(simd);
+    std::printf("%12s %10.2f %10.2f %8.1fx\n", name, scalarMillis, simdMillis, scalarMillis / simdMillis);
+}
+
+const char* levelName(const detail::simdLevel level) {
+    switch (level) {
+        case detail::simdLevel::avx2:
+            return "AVX2";
+        case detail::simdLevel::sse2:
+            return "SSE2";
+        default:
+            return "scalar";
+    }
+}
+
+}
+
+int main(const int argc, char** argv) {
+    const size_t nn = bench::arg(argc, argv, 1, 10'000'000);
+    repeats = static_cast<int>(bench::arg(argc, argv, 2, 50));
+
+    Array<int> ints;
+    Array<char> chars;
+    Array<float> floats;
+    Array<double> doubles;
+    ints.reserve(nn);
+    chars.reserve(nn);
+    floats.reserve(nn);
+    doubles.reserve(nn);
+    for (size_t i = 0; i < nn; ++i) {
+        ints.pushBack(static_cast<int>(i % 1000));
+        chars.pushBack(static_cast<char>('a' + i % 26));
+        floats.pushBack(static_cast<float>(i % 100) * 0.5f);
+        doubles.pushBack(static_cast<double>(i % 100) * 0.5);
+    }
+    const int* intData = ints.getData();
+    const char* charData = chars.getData();
+    const float* floatData = floats.getData();
+    const double* doubleData = doubles.getData();
+
+    std::printf("%zu elements, kernels use %s, ms per call\n", nn, levelName(detail::simdSupport()));
+    std::printf("%12s %10s %10s %9s\n", "kernel", "scalar", "Array", "speedup");
+    row("int find", [&] { return detail::scalarFind(intData, nn, -1); }, [&] { return ints.find(-1); });
+    row("int count", [&] { return detail::scalarCount(intData, nn, 7); }, [&] { return ints.count(7); });
+    row("char find", [&] { return detail::scalarFind(charData, nn, 'Z'); }, [&] { return chars.find('Z'); });
+    row("char count", [&] { return detail::scalarCount(charData, nn, 'q'); }, [&] { return chars.count('q'); });
+    row("int min", [&] { return detail::scalarMin(intData, nn); }, [&] { return ints.min(); });
+    row("int max", [&] { return detail::scalarMax(intData, nn); }, [&] { return ints.max(); });
+    row("int sum", [&] { return detail::scalarSum(intData, nn); }, [&] { return ints.sum(); });
+    row("float sum", [&] { return detail::scalarSum(floatData, nn); }, [&] { return floats.sum(); });
+    row("double max", [&] { return detail::scalarMax(doubleData, nn); }, [&] { return doubles.max(); });
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include <cstdio>
+#include <memory>
+
+#include "../headers/Trie.h"
+#include "Bench.h"
+
+// Memory benchmark for `Trie`: inserts N random words of 4 to 11 lowercase letters and reports the
+// bytes the trie holds through its allocator, in total and per node. The allocator counts every
+// allocation, including the per-node key and child arrays it is rebound to. Runs the default trie,
+// whose node arrays allocate nothing until first used, and tries with 1 and 4 inline children.
+//
+// Usage: TrieMemoryBench [words = 1000000]
+
+using namespace mySTL::structures;
+
+namespace {
+
+size_t liveBytes = 0;
+size_t peakBytes = 0;
+
+template<typename T>
+struct CountingAlloc {
+    using value_type = T;
+
+    CountingAlloc() = default;
+
+    template<typename U>
+    CountingAlloc(const CountingAlloc<U>&) noexcept {
+
+    }
+
+    T* allocate(const size_t nn) {
+        liveBytes += nn * sizeof(T);
+        peakBytes = liveBytes > peakBytes ? liveBytes : peakBytes;
+        return std::allocator<T>().allocate(nn);
+    }
+
+    void deallocate(T* ptr, const size_t nn) noexcept {
+        liveBytes -= nn * sizeof(T);
+        std::allocator<T>().deallocate(ptr, nn);
+    }
+
+    template<typename U>
+    bool operator==(const CountingAlloc<U>&) const noexcept {
+        return true;
+    }
+};
+
+template<size_t Inline>
+void run(const char* name, const size_t words) {
+    liveBytes = peakBytes = 0;
+    bench::Xorshift rng{ 0x9E3779B97F4A7C15ull };
+    const bench::Stopwatch watch;
+    Trie<char, CountingAlloc<char>, Inline> trie;
+    char word[16];
+    for (size_t i = 0; i < words; ++i) {
+        const size_t len = 4 + rng() % 8;
+        for (size_t j = 0; j < len; ++j) {
+            word[j] = static_cast<char>('a' + rng() % 26);
+        }
+        trie.insert(word, len);
+    }
+    const double millis = watch.millis();
+    const size_t nodes = trie.countNodes();
+    std::printf("%20s %10zu %10zu %11.1f %11.1f %9.1f %9.0f\n", name, trie.size(), nodes, liveBytes / 1048576.0, peakBytes / 1048576.0,
+                static_cast<double>(liveBytes) / static_cast<double>(nodes), millis);
+}
+
+}
+
+int main(const int argc, char** argv) {
+    const size_t words = bench::arg(argc, argv, 1, 1'000'000);
+
+    std::printf("%20s %10s %10s %11s %11s %9s %9s\n", "trie", "words", "nodes", "live MB", "peak MB", "B/node", "insert ms");
+    run<0>("Trie<char>", words);
+    run<1>("Trie<char, 1 inline>", words);
+    run<4>("Trie<char, 4 inline>", words);
+    return 0;
+}
@@ -0,0 +1,176 @@
+//
+// Created by Ivor_Aif on 2026/10/17.
+//
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "Containers.h"
+
+namespace mySTL::memory {
+
+// Bump allocator over a chain of blocks. Memory handed out is only given back all at once, by
+// `reset()` or `release()`. Not thread-safe.
+class Arena {
+private:
+    struct Block {
+        Block* next;
+        size_t size;
+    };
+
+    static constexpr size_t headerSize = (sizeof(Block) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+    Block* head = nullptr;
+    unsigned char* cursor = nullptr;
+    unsigned char* limit = nullptr;
+    size_t nextSize;
+    size_t bytesUsed = 0;
+
+    static unsigned char* payload(Block* block) noexcept {
+        return reinterpret_cast<unsigned char*>(block) + headerSize;
+    }
+
+    void addBlock(const size_t minimum) {
+        size_t size = nextSize;
+        while (size < minimum) {
+            size <<= 1;
+        }
+        auto* block = static_cast<Block*>(::operator new(headerSize + size));
+        block->next = head;
+        block->size = size;
+        head = block;
+        cursor = payload(block);
+        limit = cursor + size;
+        nextSize = size << 1;
+    }
+
+public:
+    explicit Arena(const size_t blockSize = 4096) : nextSize(blockSize ? blockSize : 1) {
+
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    ~Arena() noexcept {
+        release();
+    }
+
+    [[nodiscard]] void* allocate(const size_t bytes, const size_t align = alignof(std::max_align_t)) {
+        auto addr = reinterpret_cast<std::uintptr_t>(cursor);
+        size_t pad = (align - addr % align) % align;
+        if (!head || pad + bytes > static_cast<size_t>(limit - cursor)) {
+            addBlock(bytes + align);
+            addr = reinterpret_cast<std::uintptr_t>(cursor);
+            pad = (align - addr % align) % align;
+        }
+        unsigned char* ret = cursor + pad;
+        cursor = ret + bytes;
+        bytesUsed += bytes;
+        return ret;
+    }
+
+    // Keeps the newest (largest) block for reuse and frees the rest.
+    void reset() noexcept {
+        if (!head) {
+            return;
+        }
+        Block* keep = head;
+        for (Block* block = keep->next; block; ) {
+            Block* next = block->next;
+            ::operator delete(block);
+            block = next;
+        }
+        keep->next = nullptr;
+        cursor = payload(keep);
+        limit = cursor + keep->size;
+        bytesUsed = 0;
+    }
+
+    void release() noexcept {
+        while (head) {
+            Block* next = head->next;
+            ::operator delete(head);
+            head = next;
+        }
+        cursor = limit = nullptr;
+        bytesUsed = 0;
+    }
+
+    [[nodiscard]] size_t used() const noexcept {
+        return bytesUsed;
+    }
+
+    [[nodiscard]] size_t reserved() const noexcept {
+        size_t total = 0;
+        for (const Block* block = head; block; block = block->next) {
+            total += block->size;
+        }
+        return total;
+    }
+};
+
+// Allocator view of an `Arena`; `deallocate` does nothing. Every copy, rebind included, draws from
+// the same arena, and the arena must outlive every container using it.
+template<typename T>
+class ArenaAllocator {
+private:
+    template<typename U>
+    friend class ArenaAllocator;
+
+    Arena* arena;
+
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    explicit ArenaAllocator(Arena& arena) noexcept : arena(&arena) {
+
+    }
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {
+
+    }
+
+    [[nodiscard]] T* allocate(const size_t nn) {
+        return static_cast<T*>(arena->allocate(nn * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, size_t) noexcept {
+
+    }
+
+    [[nodiscard]] Arena& getArena() const noexcept {
+        return *arena;
+    }
+
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return arena == other.arena;
+    }
+
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+        return arena != other.arena;
+    }
+};
+
+}
+
+namespace mySTL::containers::detail {
+
+template<typename T>
+struct isMonotonicAlloc<memory::ArenaAllocator<T>> : std::true_type {
+
+};
+
+}
+
+#endif // ARENA_H
@@ -6,29 +6,30 @@
 #define ARRAY_H
 
 #include "Containers.h"
+#include "Simd.h"
 
 namespace mySTL::containers {
 
-template<typename T>
+template<typename T, typename Growth = detail::eagerGrowth, typename Storage = detail::conStorage<T, std::allocator<T>, Growth>>
 class Array {
 private:
-    detail::conStorage<T> data;
+    Storage data;
 
 public:
+    using allocatorType = typename Storage::allocatorType;
+
     Array() = default;
 
-    Array(const size_t nn, const T& value) {
-        data.reserve(nn);
-        for (size_t i = 0; i < nn; ++i) {
-            data.append(value);
-        }
+    explicit Array(const allocatorType& alloc) : data(alloc) {
+
     }
 
-    Array(std::initializer_list<T> init) {
-        data.reserve(init.size());
-        for (const T& value : init) {
-            data.append(value);
-        }
+    Array(const size_t nn, const T& value) : data(allocatorType(), nn) {
+        data.resize(nn, value);
+    }
+
+    Array(std::initializer_list<T> init) : data(allocatorType(), init.size()) {
+        data.appendRange(init.begin(), init.end());
     }
 
     Array(Array&&) noexcept = default;
@@ -78,6 +79,43 @@ public:
         data.append_(std::forward<Args>(args)...);
     }
 
+    template<typename InputIt, std::enable_if_t<!std::is_integral_v<InputIt>>* = nullptr>
+    void append(InputIt first, InputIt last) {
+        data.appendRange(first, last);
+    }
+
+    void append(const T* src, const size_t nn) {
+        data.appendRange(src, src + nn);
+    }
+
+    template<typename InputIt, std::enable_if_t<!std::is_integral_v<InputIt>>* = nullptr>
+    void insert(const size_t pos, InputIt first, InputIt last) {
+        if (pos > data.getSize()) {
+            throw std::out_of_range("Array::insert");
+        }
+        data.insertRange(pos, first, last);
+    }
+
+    void resize(const size_t nn) {
+        data.resize(nn);
+    }
+
+    void resize(const size_t nn, const T& value) {
+        data.resize(nn, value);
+    }
+
+    // Elements past the old size are left uninitialized; write them through the returned buffer.
+    T* resizeUninitialized(const size_t nn) {
+        data.resizeUninitialized(nn);
+        return data.getData();
+    }
+
+    T* appendUninitialized(const size_t nn) {
+        const size_t oldSize = data.getSize();
+        data.resizeUninitialized(oldSize + nn);
+        return data.getData() + oldSize;
+    }
+
     T& get(size_t index) {
         if (index >= data.getSize()) {
             throw std::out_of_range("Array::get");
@@ -96,6 +134,40 @@ public:
         data.omit();
     }
 
+    [[nodiscard]] size_t find(const T& value, const size_t pos = 0) const {
+        if (pos >= data.getSize()) {
+            return static_cast<size_t>(-1);
+        }
+        const size_t idx = detail::simdFind(data.getData() + pos, data.getSize() - pos, value);
+        return idx == detail::simdNpos ? idx : pos + idx;
+    }
+
+    [[nodiscard]] size_t count(const T& value) const {
+        return detail::simdCount(data.getData(), data.getSize(), value);
+    }
+
+    [[nodiscard]] bool contains(const T& value) const {
+        return find(value) != static_cast<size_t>(-1);
+    }
+
+    [[nodiscard]] T min() const {
+        if (data.getSize() == 0) {
+            throw std::out_of_range("Array::min");
+        }
+        return detail::simdMin(data.getData(), data.getSize());
+    }
+
+    [[nodiscard]] T max() const {
+        if (data.getSize() == 0) {
+            throw std::out_of_range("Array::max");
+        }
+        return detail::simdMax(data.getData(), data.getSize());
+    }
+
+    [[nodiscard]] T sum() const {
+        return detail::simdSum(data.getData(), data.getSize());
+    }
+
     T* begin() noexcept {
         return data.getData();
     }
@@ -146,6 +218,14 @@ public:
     }
 };
 
+template<typename T, size_t N>
+using SmallArray = Array<T, detail::eagerGrowth, detail::smallStorage<T, N>>;
+
+template<typename T, typename Growth, typename Storage>
+struct detail::isTriviallyRelocatable<Array<T, Growth, Storage>> : isTriviallyRelocatable<Storage> {
+
+};
+
 }
 
 #endif // ARRAY_H
@@ -170,7 +170,9 @@ public:
     }
 
     void clear() {
-        destroySubtree(root);
+        if constexpr (!containers::detail::isMonotonicAllocV<NodeAlloc> || !std::is_trivially_destructible_v<Node>) {
+            destroySubtree(root);
+        }
         root = nullptr;
         nodeCount = 0;
     }
@@ -0,0 +1,458 @@
+//
+// Created by Ivor_Aif on 2026/10/17.
+//
+
+#ifndef CHUNKEDARRAY_H
+#define CHUNKEDARRAY_H
+
+#include <bit>
+#include <cassert>
+#include <stdexcept>
+#include <utility>
+
+#include "Containers.h"
+
+namespace mySTL::containers {
+
+namespace detail {
+
+template<typename T>
+constexpr size_t defaultChunkSize = sizeof(T) < 256 ? std::bit_floor(4096 / sizeof(T)) : 16;
+
+}
+
+// Double-ended sequence stored in fixed-size chunks reached through a map of chunk pointers.
+// Both ends grow in O(1) amortized time, elements never move once constructed, and indexing is
+// two loads. Live elements occupy the global slots [first, first + count) of the map.
+template<typename T, typename Alloc = std::allocator<T>, size_t ChunkSize = detail::defaultChunkSize<T>>
+class ChunkedArray {
+    static_assert(std::has_single_bit(ChunkSize), "ChunkSize must be a power of two");
+
+private:
+    using allocTraits = std::allocator_traits<Alloc>;
+    using MapAlloc = typename allocTraits::template rebind_alloc<T*>;
+    using mapTraits = std::allocator_traits<MapAlloc>;
+
+    static constexpr size_t shift = std::countr_zero(ChunkSize);
+    static constexpr size_t mask = ChunkSize - 1;
+    static constexpr size_t minMap = 8;
+
+    Alloc alloc;
+    T** map = nullptr;
+    size_t mapCap = 0;
+    size_t first = 0;
+    size_t count = 0;
+    // One emptied chunk is kept back so a queue crossing a chunk boundary does not hit the allocator.
+    T* spare = nullptr;
+
+    T* slot(const size_t pos) const noexcept {
+        return map[pos >> shift] + (pos & mask);
+    }
+
+    T* takeChunk() {
+        if (spare) {
+            return std::exchange(spare, nullptr);
+        }
+        return allocTraits::allocate(alloc, ChunkSize);
+    }
+
+    void dropChunk(T* chunk) noexcept {
+        if (!spare) {
+            spare = chunk;
+            return;
+        }
+        allocTraits::deallocate(alloc, chunk, ChunkSize);
+    }
+
+    // Moves the chunks holding live elements to the middle of a map with room on both sides.
+    void remap() {
+        const size_t lo = first >> shift;
+        const size_t used = count ? ((first + count - 1) >> shift) - lo + 1 : 0;
+        const size_t newCap = std::max(minMap, 2 * (used + 1));
+        MapAlloc mapAlloc(alloc);
+        T** newMap = mapTraits::allocate(mapAlloc, newCap);
+        const size_t newLo = (newCap - used) / 2;
+        std::fill(newMap, newMap + newCap, nullptr);
+        for (size_t i = 0; i < mapCap; ++i) {
+            if (!map[i]) {
+                continue;
+            }
+            if (i >= lo && i < lo + used) {
+                newMap[newLo + i - lo] = map[i];
+            } else {
+                dropChunk(map[i]);
+            }
+        }
+        if (map) {
+            mapTraits::deallocate(mapAlloc, map, mapCap);
+        }
+        map = newMap;
+        mapCap = newCap;
+        first = (newLo << shift) + (count ? first & mask : ChunkSize / 2);
+    }
+
+    T* backSlot() {
+        if (((first + count) >> shift) >= mapCap) {
+            remap();
+        }
+        const size_t pos = first + count;
+        T*& chunk = map[pos >> shift];
+        if (!chunk) {
+            chunk = takeChunk();
+        }
+        return chunk + (pos & mask);
+    }
+
+    T* frontSlot() {
+        if (first == 0 || !map) {
+            remap();
+        }
+        const size_t pos = first - 1;
+        T*& chunk = map[pos >> shift];
+        if (!chunk) {
+            chunk = takeChunk();
+        }
+        return chunk + (pos & mask);
+    }
+
+    void releaseAll() noexcept {
+        clear();
+        for (size_t i = 0; i < mapCap; ++i) {
+            if (map[i]) {
+                allocTraits::deallocate(alloc, map[i], ChunkSize);
+            }
+        }
+        if (spare) {
+            allocTraits::deallocate(alloc, spare, ChunkSize);
+        }
+        if (map) {
+            MapAlloc mapAlloc(alloc);
+            mapTraits::deallocate(mapAlloc, map, mapCap);
+        }
+        map = nullptr;
+        spare = nullptr;
+        mapCap = first = 0;
+    }
+
+public:
+    template<bool IsConst>
+    class IteratorBase;
+    using Iterator = IteratorBase<false>;
+    using ConstIterator = IteratorBase<true>;
+
+    ChunkedArray() = default;
+
+    explicit ChunkedArray(const Alloc& a) : alloc(a) {
+
+    }
+
+    ChunkedArray(const ChunkedArray& other) : alloc(allocTraits::select_on_container_copy_construction(other.alloc)) {
+        try {
+            for (size_t i = 0; i < other.count; ++i) {
+                pushBack(other[i]);
+            }
+        } catch (...) {
+            releaseAll();
+            throw;
+        }
+    }
+
+    ChunkedArray(ChunkedArray&& other) noexcept : alloc(other.alloc) {
+        swap(other);
+    }
+
+    ChunkedArray& operator=(const ChunkedArray& other) {
+        if (this != &other) {
+            ChunkedArray tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    ChunkedArray& operator=(ChunkedArray&& other) noexcept {
+        if (this != &other) {
+            ChunkedArray tmp(std::move(other));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    ~ChunkedArray() noexcept {
+        releaseAll();
+    }
+
+    void swap(ChunkedArray& other) noexcept {
+        std::swap(alloc, other.alloc);
+        std::swap(map, other.map);
+        std::swap(mapCap, other.mapCap);
+        std::swap(first, other.first);
+        std::swap(count, other.count);
+        std::swap(spare, other.spare);
+    }
+
+    [[nodiscard]] size_t length() const noexcept {
+        return count;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return count == 0;
+    }
+
+    void clear() noexcept {
+        while (count) {
+            popBack();
+        }
+    }
+
+    template<typename... Args>
+    T& emplaceBack(Args&&... args) {
+        T* ptr = backSlot();
+        allocTraits::construct(alloc, ptr, std::forward<Args>(args)...);
+        ++count;
+        return *ptr;
+    }
+
+    template<typename... Args>
+    T& emplaceFront(Args&&... args) {
+        T* ptr = frontSlot();
+        allocTraits::construct(alloc, ptr, std::forward<Args>(args)...);
+        --first;
+        ++count;
+        return *ptr;
+    }
+
+    void pushBack(const T& value) {
+        emplaceBack(value);
+    }
+
+    void pushBack(T&& value) {
+        emplaceBack(std::move(value));
+    }
+
+    void pushFront(const T& value) {
+        emplaceFront(value);
+    }
+
+    void pushFront(T&& value) {
+        emplaceFront(std::move(value));
+    }
+
+    void popFront() noexcept {
+        if (!count) {
+            return;
+        }
+        const size_t chunk = first >> shift;
+        allocTraits::destroy(alloc, slot(first));
+        ++first;
+        if (--count == 0 || (first & mask) == 0) {
+            dropChunk(std::exchange(map[chunk], nullptr));
+        }
+    }
+
+    void popBack() noexcept {
+        if (!count) {
+            return;
+        }
+        const size_t last = first + count - 1, chunk = last >> shift;
+        allocTraits::destroy(alloc, slot(last));
+        if (--count == 0 || (last & mask) == 0) {
+            dropChunk(std::exchange(map[chunk], nullptr));
+        }
+    }
+
+    T& front() {
+        assert(!empty());
+        return *slot(first);
+    }
+
+    const T& front() const {
+        assert(!empty());
+        return *slot(first);
+    }
+
+    T& back() {
+        assert(!empty());
+        return *slot(first + count - 1);
+    }
+
+    const T& back() const {
+        assert(!empty());
+        return *slot(first + count - 1);
+    }
+
+    T& operator[](const size_t index) noexcept {
+        return *slot(first + index);
+    }
+
+    const T& operator[](const size_t index) const noexcept {
+        return *slot(first + index);
+    }
+
+    T& at(const size_t index) {
+        if (index >= count) {
+            throw std::out_of_range("ChunkedArray::at");
+        }
+        return (*this)[index];
+    }
+
+    [[nodiscard]] const T& at(const size_t index) const {
+        if (index >= count) {
+            throw std::out_of_range("ChunkedArray::at");
+        }
+        return (*this)[index];
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, count);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(this, count);
+    }
+
+    ConstIterator beginConst() const noexcept {
+        return begin();
+    }
+
+    ConstIterator endConst() const noexcept {
+        return end();
+    }
+
+    template<bool IsConst>
+    class IteratorBase {
+        friend class ChunkedArray;
+
+        template<bool>
+        friend class IteratorBase;
+
+    private:
+        using Owner = std::conditional_t<IsConst, const ChunkedArray, ChunkedArray>;
+
+        Owner* owner = nullptr;
+        size_t index = 0;
+
+        IteratorBase(Owner* owner, const size_t index) : owner(owner), index(index) {
+
+        }
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        IteratorBase() = default;
+
+        template<bool OtherConst, std::enable_if_t<IsConst && !OtherConst>* = nullptr>
+        IteratorBase(const IteratorBase<OtherConst>& other) : owner(other.owner), index(other.index) {
+
+        }
+
+        reference operator*() const {
+            return (*owner)[index];
+        }
+
+        pointer operator->() const {
+            return &(*owner)[index];
+        }
+
+        reference operator[](const difference_type nn) const {
+            return (*owner)[index + nn];
+        }
+
+        IteratorBase& operator++() {
+            ++index;
+            return *this;
+        }
+
+        IteratorBase operator++(int) {
+            IteratorBase tmp = *this;
+            ++index;
+            return tmp;
+        }
+
+        IteratorBase& operator--() {
+            --index;
+            return *this;
+        }
+
+        IteratorBase operator--(int) {
+            IteratorBase tmp = *this;
+            --index;
+            return tmp;
+        }
+
+        IteratorBase& operator+=(const difference_type nn) {
+            index += nn;
+            return *this;
+        }
+
+        IteratorBase& operator-=(const difference_type nn) {
+            index -= nn;
+            return *this;
+        }
+
+        IteratorBase operator+(const difference_type nn) const {
+            return IteratorBase(owner, index + nn);
+        }
+
+        friend IteratorBase operator+(const difference_type nn, const IteratorBase& it) {
+            return it + nn;
+        }
+
+        IteratorBase operator-(const difference_type nn) const {
+            return IteratorBase(owner, index - nn);
+        }
+
+        difference_type operator-(const IteratorBase& other) const {
+            return static_cast<difference_type>(index) - static_cast<difference_type>(other.index);
+        }
+
+        bool operator==(const IteratorBase& other) const {
+            return index == other.index && owner == other.owner;
+        }
+
+        bool operator!=(const IteratorBase& other) const {
+            return !(*this == other);
+        }
+
+        bool operator<(const IteratorBase& other) const {
+            return index < other.index;
+        }
+
+        bool operator>(const IteratorBase& other) const {
+            return index > other.index;
+        }
+
+        bool operator<=(const IteratorBase& other) const {
+            return index <= other.index;
+        }
+
+        bool operator>=(const IteratorBase& other) const {
+            return index >= other.index;
+        }
+    };
+};
+
+template<typename T, typename Alloc, size_t ChunkSize>
+void swap(ChunkedArray<T, Alloc, ChunkSize>& left, ChunkedArray<T, Alloc, ChunkSize>& right) noexcept {
+    left.swap(right);
+}
+
+template<typename T, typename Alloc, size_t ChunkSize>
+struct detail::isTriviallyRelocatable<ChunkedArray<T, Alloc, ChunkSize>> : std::bool_constant<std::is_empty_v<Alloc>> {
+
+};
+
+}
+
+#endif // CHUNKEDARRAY_H
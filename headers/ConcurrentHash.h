@@ -0,0 +1,246 @@
+//
+// Created by Ivor_Aif on 2026/10/18.
+//
+
+#ifndef CONCURRENTHASH_H
+#define CONCURRENTHASH_H
+
+#include <bit>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "Hash.h"
+
+namespace mySTL::containers {
+
+// `Hash` split into independently locked shards. A key's shard comes from the top bits of its hash
+// times the golden ratio, so even an identity `HashFn` spreads keys evenly, and the shard's own
+// `Hash` then reuses the same hash through `find(key, hash)`.
+//
+// Readers take their shard's lock shared. An optimistic seqlock is not an option here: `Hash` keeps
+// its entries in list nodes, and a reader racing an erase could follow a node that was just freed.
+//
+// Nothing hands out iterators or references; values are copied out, or visited under the lock.
+// `Alloc` is shared by every shard and must be thread-safe (std::allocator and
+// `memory::PoolAllocator` are).
+template<typename Key, typename T, typename HashFn = hash::Hasher<Key>, typename KeyEqual = std::equal_to<Key>, typename Alloc = std::allocator<detail::KeyValue<const Key, T>>>
+class ConcurrentHash {
+private:
+    using Map = Hash<Key, T, HashFn, KeyEqual, Alloc>;
+
+    struct alignas(detail::cacheLineSize) Shard {
+        mutable std::shared_mutex lock;
+        Map map;
+
+        Shard(const size_t bucketCount, const HashFn& hf, const KeyEqual& eq, const Alloc& alloc) : map(bucketCount, hf, eq, alloc) {
+
+        }
+    };
+
+    Shard* shards;
+    size_t shardCount;
+    unsigned shardShift;
+    HashFn hashFn;
+
+    static size_t defaultShardCount() noexcept {
+        return std::bit_ceil(std::max<size_t>(std::thread::hardware_concurrency(), 1) * 4);
+    }
+
+    Shard& shardFor(const size_t hash) const noexcept {
+        const auto spread = static_cast<std::uint64_t>(hash) * 0x9E3779B97F4A7C15ull;
+        return shards[shardShift == 64 ? 0 : static_cast<size_t>(spread >> shardShift)];
+    }
+
+public:
+    // `shardCount` is rounded up to a power of two; 0 picks four shards per hardware thread.
+    explicit ConcurrentHash(size_t shardCount = 0, const size_t bucketCount = 0, const HashFn& hf = HashFn(), const KeyEqual& eq = KeyEqual(), const Alloc& alloc = Alloc()) : shardCount(std::bit_ceil(shardCount ? shardCount : defaultShardCount())), hashFn(hf) {
+        shardShift = 64 - std::countr_zero(this->shardCount);
+        shards = static_cast<Shard*>(::operator new[](this->shardCount * sizeof(Shard), std::align_val_t(alignof(Shard))));
+        const size_t perShard = bucketCount / this->shardCount;
+        size_t built = 0;
+        try {
+            for (; built < this->shardCount; ++built) {
+                new (&shards[built]) Shard(perShard, hf, eq, alloc);
+            }
+        } catch (...) {
+            destroyShards(built);
+            throw;
+        }
+    }
+
+    ConcurrentHash(const ConcurrentHash&) = delete;
+    ConcurrentHash& operator=(const ConcurrentHash&) = delete;
+
+    // Must not race with any other member call.
+    ~ConcurrentHash() {
+        destroyShards(shardCount);
+    }
+
+    [[nodiscard]] size_t getShardCount() const noexcept {
+        return shardCount;
+    }
+
+    // Sum of the shard sizes, each read under its own lock; not a snapshot of the whole table.
+    [[nodiscard]] size_t getSize() const {
+        size_t total = 0;
+        for (size_t i = 0; i < shardCount; ++i) {
+            std::shared_lock guard(shards[i].lock);
+            total += shards[i].map.getSize();
+        }
+        return total;
+    }
+
+    [[nodiscard]] bool isEmpty() const {
+        return getSize() == 0;
+    }
+
+    // Inserts `value` under `key` if the key is absent; true if it was inserted.
+    template<typename V>
+    bool insert(const Key& key, V&& value) {
+        Shard& shard = shardFor(hashFn(key));
+        std::unique_lock guard(shard.lock);
+        return shard.map.emplace(key, std::forward<V>(value)).second;
+    }
+
+    // Inserts or overwrites; true if the key was new.
+    template<typename V>
+    bool insertOrAssign(const Key& key, V&& value) {
+        const size_t hash = hashFn(key);
+        Shard& shard = shardFor(hash);
+        std::unique_lock guard(shard.lock);
+        if (auto it = shard.map.find(key, hash); it != shard.map.end()) {
+            it->second = std::forward<V>(value);
+            return false;
+        }
+        shard.map.emplace(key, std::forward<V>(value));
+        return true;
+    }
+
+    // Returns the value under `key`, first storing `make()` there if the key is absent. A hit only
+    // takes the shared lock; `make` runs under the exclusive lock, so it is called at most once per
+    // key and must not touch this table.
+    template<typename Fn>
+    T computeIfAbsent(const Key& key, Fn&& make) {
+        const size_t hash = hashFn(key);
+        Shard& shard = shardFor(hash);
+        {
+            std::shared_lock guard(shard.lock);
+            if (auto it = shard.map.find(key, hash); it != shard.map.end()) {
+                return it->second;
+            }
+        }
+        std::unique_lock guard(shard.lock);
+        if (auto it = shard.map.find(key, hash); it != shard.map.end()) {
+            return it->second;
+        }
+        return shard.map.emplace(key, std::forward<Fn>(make)()).first->second;
+    }
+
+    // Copies the value under `key` into `out`; false if the key is absent.
+    bool tryGet(const Key& key, T& out) const {
+        const size_t hash = hashFn(key);
+        const Shard& shard = shardFor(hash);
+        std::shared_lock guard(shard.lock);
+        auto it = std::as_const(shard.map).find(key, hash);
+        if (it == shard.map.end()) {
+            return false;
+        }
+        out = it->second;
+        return true;
+    }
+
+    T get(const Key& key) const {
+        T out;
+        if (!tryGet(key, out)) {
+            throw std::out_of_range("ConcurrentHash::get");
+        }
+        return out;
+    }
+
+    bool contains(const Key& key) const {
+        const size_t hash = hashFn(key);
+        const Shard& shard = shardFor(hash);
+        std::shared_lock guard(shard.lock);
+        return shard.map.contains(key, hash);
+    }
+
+    // Calls `fn(value)` on the value under `key` while holding the shard exclusively; false if the
+    // key is absent.
+    template<typename Fn>
+    bool update(const Key& key, Fn&& fn) {
+        const size_t hash = hashFn(key);
+        Shard& shard = shardFor(hash);
+        std::unique_lock guard(shard.lock);
+        auto it = shard.map.find(key, hash);
+        if (it == shard.map.end()) {
+            return false;
+        }
+        std::forward<Fn>(fn)(it->second);
+        return true;
+    }
+
+    size_t erase(const Key& key) {
+        const size_t hash = hashFn(key);
+        Shard& shard = shardFor(hash);
+        std::unique_lock guard(shard.lock);
+        auto it = shard.map.find(key, hash);
+        if (it == shard.map.end()) {
+            return 0;
+        }
+        shard.map.erase(it);
+        return 1;
+    }
+
+    // Calls `fn(key, value)` for every entry, one shard at a time under that shard's shared lock.
+    // Entries inserted or erased in a shard not yet visited may or may not be seen. `fn` must not
+    // write to this table.
+    template<typename Fn>
+    void forEach(Fn&& fn) const {
+        for (size_t i = 0; i < shardCount; ++i) {
+            std::shared_lock guard(shards[i].lock);
+            for (const auto& entry : shards[i].map) {
+                fn(entry.first, entry.second);
+            }
+        }
+    }
+
+    void clear() {
+        for (size_t i = 0; i < shardCount; ++i) {
+            std::unique_lock guard(shards[i].lock);
+            shards[i].map.clear();
+        }
+    }
+
+    // Reserves room for `count` entries spread evenly over the shards.
+    void reserve(const size_t count) {
+        const size_t perShard = (count + shardCount - 1) / shardCount;
+        for (size_t i = 0; i < shardCount; ++i) {
+            std::unique_lock guard(shards[i].lock);
+            shards[i].map.reserve(perShard);
+        }
+    }
+
+    void setMaxLoadFactor(const double lf) {
+        for (size_t i = 0; i < shardCount; ++i) {
+            std::unique_lock guard(shards[i].lock);
+            shards[i].map.setMaxLoadFactor(lf);
+        }
+    }
+
+private:
+    void destroyShards(const size_t count) noexcept {
+        for (size_t i = 0; i < count; ++i) {
+            shards[i].~Shard();
+        }
+        ::operator delete[](shards, std::align_val_t(alignof(Shard)));
+    }
+};
+
+}
+
+#endif // CONCURRENTHASH_H
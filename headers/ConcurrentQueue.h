@@ -0,0 +1,380 @@
+//
+// Created by Ivor_Aif on 2026/10/17.
+//
+
+#ifndef CONCURRENTQUEUE_H
+#define CONCURRENTQUEUE_H
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Containers.h"
+
+namespace mySTL::structures {
+
+// Bounded single-producer/single-consumer ring. Each side keeps a private copy of the other side's
+// index and only reloads it when the ring looks full (or empty), so the shared cache lines are
+// touched once per batch rather than once per element.
+template<typename T, typename Alloc = std::allocator<T>>
+class SpscQueue {
+private:
+    using allocTraits = std::allocator_traits<Alloc>;
+    static constexpr size_t line = containers::detail::cacheLineSize;
+
+    Alloc alloc;
+    T* slots;
+    size_t mask;
+
+    alignas(line) std::atomic<size_t> head{0};
+    size_t cachedTail = 0;
+    alignas(line) std::atomic<size_t> tail{0};
+    size_t cachedHead = 0;
+
+    [[nodiscard]] size_t readable(const size_t pos, const size_t want) {
+        if (cachedTail - pos < want) {
+            cachedTail = tail.load(std::memory_order_acquire);
+        }
+        return cachedTail - pos;
+    }
+
+    [[nodiscard]] size_t writable(const size_t pos, const size_t want) {
+        if (mask + 1 - (pos - cachedHead) < want) {
+            cachedHead = head.load(std::memory_order_acquire);
+        }
+        return mask + 1 - (pos - cachedHead);
+    }
+
+public:
+    // The capacity is rounded up to a power of two.
+    explicit SpscQueue(const size_t cap, const Alloc& a = Alloc()) : alloc(a) {
+        if (cap == 0) {
+            throw std::invalid_argument("SpscQueue capacity");
+        }
+        const size_t rounded = std::bit_ceil(cap);
+        slots = allocTraits::allocate(alloc, rounded);
+        mask = rounded - 1;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    ~SpscQueue() {
+        for (size_t pos = head.load(std::memory_order_relaxed), end = tail.load(std::memory_order_relaxed); pos != end; ++pos) {
+            allocTraits::destroy(alloc, slots + (pos & mask));
+        }
+        allocTraits::deallocate(alloc, slots, mask + 1);
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept {
+        return mask + 1;
+    }
+
+    // Exact only when called from the producer or the consumer while the other side is idle.
+    [[nodiscard]] size_t sizeApprox() const noexcept {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] bool emptyApprox() const noexcept {
+        return sizeApprox() == 0;
+    }
+
+    // Producer side.
+    template<typename... Args>
+    bool tryEmplace(Args&&... args) {
+        const size_t pos = tail.load(std::memory_order_relaxed);
+        if (!writable(pos, 1)) {
+            return false;
+        }
+        allocTraits::construct(alloc, slots + (pos & mask), std::forward<Args>(args)...);
+        tail.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool tryPush(const T& value) {
+        return tryEmplace(value);
+    }
+
+    bool tryPush(T&& value) {
+        return tryEmplace(std::move(value));
+    }
+
+    // Producer side. Pushes up to `nn` elements from `first`, publishing them together; returns how many.
+    // If building an element throws, the ones already built are published before rethrowing.
+    template<typename InputIt>
+    size_t tryPushN(InputIt first, const size_t nn) {
+        const size_t pos = tail.load(std::memory_order_relaxed);
+        size_t room = writable(pos, nn);
+        if (room > nn) {
+            room = nn;
+        }
+        size_t built = 0;
+        try {
+            for (; built < room; ++first) {
+                allocTraits::construct(alloc, slots + ((pos + built) & mask), *first);
+                ++built;
+            }
+        } catch (...) {
+            if (built) {
+                tail.store(pos + built, std::memory_order_release);
+            }
+            throw;
+        }
+        if (room) {
+            tail.store(pos + room, std::memory_order_release);
+        }
+        return room;
+    }
+
+    // Consumer side.
+    bool tryPop(T& out) {
+        const size_t pos = head.load(std::memory_order_relaxed);
+        if (!readable(pos, 1)) {
+            return false;
+        }
+        T* slot = slots + (pos & mask);
+        out = std::move(*slot);
+        allocTraits::destroy(alloc, slot);
+        head.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side. Moves up to `nn` elements into `out`, releasing their slots together; returns how many.
+    // If writing to `out` throws, the slots already emptied are released before rethrowing.
+    template<typename OutputIt>
+    size_t tryPopN(OutputIt out, const size_t nn) {
+        const size_t pos = head.load(std::memory_order_relaxed);
+        size_t ready = readable(pos, nn);
+        if (ready > nn) {
+            ready = nn;
+        }
+        size_t taken = 0;
+        try {
+            while (taken < ready) {
+                T* slot = slots + ((pos + taken) & mask);
+                *out = std::move(*slot);
+                allocTraits::destroy(alloc, slot);
+                ++taken;
+                ++out;
+            }
+        } catch (...) {
+            if (taken) {
+                head.store(pos + taken, std::memory_order_release);
+            }
+            throw;
+        }
+        if (ready) {
+            head.store(pos + ready, std::memory_order_release);
+        }
+        return ready;
+    }
+};
+
+// Bounded multi-producer/multi-consumer ring after Dmitry Vyukov's design: every cell carries a
+// sequence number that says whether it is free for ticket `pos` (seq == pos) or holds the element of
+// ticket `pos` (seq == pos + 1). Producers and consumers only contend on their own ticket counter.
+//
+// A claimed ticket cannot be handed back, so nothing between claiming a cell and publishing it may
+// throw: T must move without throwing, an element whose construction can throw is built before its
+// ticket is claimed, and a consumer whose `out` throws drops the element it was writing.
+template<typename T, typename Alloc = std::allocator<T>>
+class MpmcQueue {
+    static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>, "MpmcQueue needs a nothrow-movable T");
+
+private:
+    using allocTraits = std::allocator_traits<Alloc>;
+    static constexpr size_t line = containers::detail::cacheLineSize;
+
+    struct Cell {
+        std::atomic<size_t> seq;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+    };
+
+    using CellAlloc = typename allocTraits::template rebind_alloc<Cell>;
+    using cellTraits = std::allocator_traits<CellAlloc>;
+
+    Alloc alloc;
+    Cell* cells;
+    size_t mask;
+
+    alignas(line) std::atomic<size_t> enqueuePos{0};
+    alignas(line) std::atomic<size_t> dequeuePos{0};
+
+    static std::intptr_t lag(const size_t seq, const size_t pos) noexcept {
+        return static_cast<std::intptr_t>(seq - pos);
+    }
+
+    // Claims up to `nn` consecutive tickets whose cells have sequence `pos + i + offset`.
+    size_t claim(std::atomic<size_t>& counter, const size_t offset, const size_t nn, size_t& pos) {
+        pos = counter.load(std::memory_order_relaxed);
+        while (true) {
+            size_t ready = 0;
+            while (ready < nn && ready <= mask && cells[(pos + ready) & mask].seq.load(std::memory_order_acquire) == pos + ready + offset) {
+                ++ready;
+            }
+            if (ready == 0) {
+                if (lag(cells[pos & mask].seq.load(std::memory_order_acquire), pos + offset) < 0) {
+                    return 0;
+                }
+                pos = counter.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (counter.compare_exchange_weak(pos, pos + ready, std::memory_order_relaxed)) {
+                return ready;
+            }
+        }
+    }
+
+    // Destroys the element of consumer ticket `pos` and hands its cell to producer ticket `pos + capacity`.
+    void release(Cell& cell, const size_t pos) noexcept {
+        allocTraits::destroy(alloc, cell.value());
+        cell.seq.store(pos + mask + 1, std::memory_order_release);
+    }
+
+public:
+    // The capacity is rounded up to a power of two, at least 2.
+    explicit MpmcQueue(const size_t cap, const Alloc& a = Alloc()) : alloc(a) {
+        if (cap == 0) {
+            throw std::invalid_argument("MpmcQueue capacity");
+        }
+        const size_t rounded = std::bit_ceil(cap < 2 ? size_t(2) : cap);
+        CellAlloc cellAlloc(alloc);
+        cells = cellTraits::allocate(cellAlloc, rounded);
+        for (size_t i = 0; i < rounded; ++i) {
+            ::new (static_cast<void*>(cells + i)) Cell;
+            cells[i].seq.store(i, std::memory_order_relaxed);
+        }
+        mask = rounded - 1;
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    ~MpmcQueue() {
+        for (size_t pos = dequeuePos.load(std::memory_order_relaxed), end = enqueuePos.load(std::memory_order_relaxed); pos != end; ++pos) {
+            if (Cell& cell = cells[pos & mask]; cell.seq.load(std::memory_order_relaxed) == pos + 1) {
+                allocTraits::destroy(alloc, cell.value());
+            }
+        }
+        for (size_t i = 0; i <= mask; ++i) {
+            cells[i].~Cell();
+        }
+        CellAlloc cellAlloc(alloc);
+        cellTraits::deallocate(cellAlloc, cells, mask + 1);
+    }
+
+    [[nodiscard]] size_t capacity() const noexcept {
+        return mask + 1;
+    }
+
+    [[nodiscard]] size_t sizeApprox() const noexcept {
+        const size_t enq = enqueuePos.load(std::memory_order_acquire), deq = dequeuePos.load(std::memory_order_acquire);
+        return enq > deq ? enq - deq : 0;
+    }
+
+    [[nodiscard]] bool emptyApprox() const noexcept {
+        return sizeApprox() == 0;
+    }
+
+    template<typename... Args>
+    bool tryEmplace(Args&&... args) {
+        if constexpr (!std::is_nothrow_constructible_v<T, Args&&...>) {
+            // Built up front so that a throwing constructor never strands a claimed cell.
+            T value(std::forward<Args>(args)...);
+            return tryEmplace(std::move(value));
+        } else {
+            size_t pos;
+            if (!claim(enqueuePos, 0, 1, pos)) {
+                return false;
+            }
+            Cell& cell = cells[pos & mask];
+            allocTraits::construct(alloc, cell.value(), std::forward<Args>(args)...);
+            cell.seq.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+    }
+
+    bool tryPush(const T& value) {
+        return tryEmplace(value);
+    }
+
+    bool tryPush(T&& value) {
+        return tryEmplace(std::move(value));
+    }
+
+    // Claims up to `nn` slots with one CAS and fills them from `first`; returns how many were pushed.
+    // When reading or copying from `first` may throw, elements are pushed one at a time instead.
+    template<typename InputIt>
+    size_t tryPushN(InputIt first, const size_t nn) {
+        if constexpr (!std::is_nothrow_constructible_v<T, decltype(*first)> || !noexcept(*first) || !noexcept(++first)) {
+            size_t pushed = 0;
+            for (; pushed < nn && tryEmplace(*first); ++pushed) {
+                ++first;
+            }
+            return pushed;
+        } else {
+            size_t pos;
+            const size_t got = nn ? claim(enqueuePos, 0, nn, pos) : 0;
+            for (size_t i = 0; i < got; ++i, ++first) {
+                Cell& cell = cells[(pos + i) & mask];
+                allocTraits::construct(alloc, cell.value(), *first);
+                cell.seq.store(pos + i + 1, std::memory_order_release);
+            }
+            return got;
+        }
+    }
+
+    bool tryPop(T& out) {
+        size_t pos;
+        if (!claim(dequeuePos, 1, 1, pos)) {
+            return false;
+        }
+        Cell& cell = cells[pos & mask];
+        out = std::move(*cell.value());
+        release(cell, pos);
+        return true;
+    }
+
+    // Claims up to `nn` filled slots with one CAS and moves them into `out`; returns how many. When
+    // writing to `out` may throw, elements are claimed one at a time and the one being written when
+    // it throws is dropped.
+    template<typename OutputIt>
+    size_t tryPopN(OutputIt out, const size_t nn) {
+        size_t pos;
+        if constexpr (!noexcept(*out = std::declval<T&&>()) || !noexcept(++out)) {
+            size_t popped = 0;
+            for (; popped < nn && claim(dequeuePos, 1, 1, pos); ++popped) {
+                Cell& cell = cells[pos & mask];
+                try {
+                    *out = std::move(*cell.value());
+                    ++out;
+                } catch (...) {
+                    release(cell, pos);
+                    throw;
+                }
+                release(cell, pos);
+            }
+            return popped;
+        } else {
+            const size_t got = nn ? claim(dequeuePos, 1, nn, pos) : 0;
+            for (size_t i = 0; i < got; ++i, ++out) {
+                Cell& cell = cells[(pos + i) & mask];
+                *out = std::move(*cell.value());
+                release(cell, pos + i);
+            }
+            return got;
+        }
+    }
+};
+
+}
+
+#endif // CONCURRENTQUEUE_H
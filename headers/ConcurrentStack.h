@@ -0,0 +1,324 @@
+//
+// Created by Ivor_Aif on 2026/10/18.
+//
+
+#ifndef CONCURRENTSTACK_H
+#define CONCURRENTSTACK_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#include "Array.h"
+
+namespace mySTL::structures {
+
+namespace detail {
+
+// One published pointer per thread is enough for every structure here: a pointer is only protected
+// for the few loads between reading a shared head and swinging it.
+struct hazardRecord {
+    std::atomic<const void*> pointer{nullptr};
+    std::atomic<bool> active{false};
+    hazardRecord* next = nullptr;
+};
+
+// Process-wide registry of hazard records. Records are recycled when their thread exits and are
+// never freed, so a scanner may walk the list at any time.
+class hazardDomain {
+private:
+    std::atomic<hazardRecord*> head{nullptr};
+    std::atomic<size_t> count{0};
+
+    hazardRecord* acquire() {
+        for (hazardRecord* rec = head.load(std::memory_order_acquire); rec; rec = rec->next) {
+            bool expected = false;
+            if (!rec->active.load(std::memory_order_relaxed) && rec->active.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                return rec;
+            }
+        }
+        auto* rec = new hazardRecord;
+        rec->active.store(true, std::memory_order_relaxed);
+        rec->next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(rec->next, rec, std::memory_order_release, std::memory_order_relaxed)) {
+
+        }
+        count.fetch_add(1, std::memory_order_relaxed);
+        return rec;
+    }
+
+    struct owner {
+        hazardRecord* rec;
+
+        explicit owner(hazardDomain& domain) : rec(domain.acquire()) {
+
+        }
+
+        ~owner() {
+            rec->pointer.store(nullptr, std::memory_order_release);
+            rec->active.store(false, std::memory_order_release);
+        }
+    };
+
+public:
+    // The calling thread's record.
+    hazardRecord& local() {
+        static thread_local owner mine(*this);
+        return *mine.rec;
+    }
+
+    [[nodiscard]] size_t getSize() const noexcept {
+        return count.load(std::memory_order_relaxed);
+    }
+
+    // Sorted copy of every pointer currently published.
+    void snapshot(containers::Array<const void*, containers::detail::lazyGrowth>& out) const {
+        out.clear();
+        for (hazardRecord* rec = head.load(std::memory_order_acquire); rec; rec = rec->next) {
+            if (const void* ptr = rec->pointer.load(std::memory_order_seq_cst)) {
+                out.pushBack(ptr);
+            }
+        }
+        std::sort(out.begin(), out.end());
+    }
+
+    static hazardDomain& shared() {
+        static auto* domain = new hazardDomain;
+        return *domain;
+    }
+};
+
+}
+
+// Lock-free Treiber stack. A popper publishes the head it is about to dereference as a hazard
+// pointer, so a popped node is only freed once no thread can still be reading it; this also rules
+// out ABA on the head CAS. Popped nodes collect on a per-stack retired list that is scanned against
+// the published hazards once it outgrows twice the number of threads.
+//
+// With `Elimination`, a push and a pop that both lose the head CAS may meet in a small array of
+// exchange slots and cancel out without touching the head at all.
+//
+// `Alloc` is called from several threads at once and must be thread-safe (std::allocator and
+// `memory::PoolAllocator` are).
+template<typename T, bool Elimination = false, typename Alloc = std::allocator<T>>
+class ConcurrentStack {
+private:
+    struct Node {
+        T value;
+        Node* next = nullptr;
+        Node* retiredNext = nullptr;
+
+        template<typename... Args>
+        explicit Node(Args&&... args) : value(std::forward<Args>(args)...) {
+
+        }
+    };
+
+    using NodeAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Node>;
+    using nodeTraits = std::allocator_traits<NodeAlloc>;
+
+    static constexpr size_t line = containers::detail::cacheLineSize;
+    static constexpr size_t minScan = 64;
+    static constexpr size_t exchangeSlots = 8;
+    static constexpr size_t exchangeSpins = 128;
+    static constexpr std::uintptr_t taken = 1;
+
+    struct alignas(line) exchangeSlot {
+        std::atomic<std::uintptr_t> value{0};
+    };
+
+    NodeAlloc alloc;
+    alignas(line) std::atomic<Node*> head{nullptr};
+    alignas(line) std::atomic<Node*> retired{nullptr};
+    std::atomic<size_t> retiredCount{0};
+    exchangeSlot slots[Elimination ? exchangeSlots : 1];
+
+    template<typename... Args>
+    Node* createNode(Args&&... args) {
+        Node* node = nodeTraits::allocate(alloc, 1);
+        try {
+            nodeTraits::construct(alloc, node, std::forward<Args>(args)...);
+        } catch (...) {
+            nodeTraits::deallocate(alloc, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    void destroyNode(Node* node) noexcept {
+        nodeTraits::destroy(alloc, node);
+        nodeTraits::deallocate(alloc, node, 1);
+    }
+
+    void retire(Node* node) {
+        node->retiredNext = retired.load(std::memory_order_relaxed);
+        while (!retired.compare_exchange_weak(node->retiredNext, node, std::memory_order_release, std::memory_order_relaxed)) {
+
+        }
+        const size_t threshold = std::max(minScan, 2 * detail::hazardDomain::shared().getSize());
+        if (retiredCount.fetch_add(1, std::memory_order_relaxed) + 1 >= threshold) {
+            scan();
+        }
+    }
+
+    // Frees every retired node no thread has published; the rest go back on the list.
+    void scan() {
+        Node* list = retired.exchange(nullptr, std::memory_order_seq_cst);
+        containers::Array<const void*, containers::detail::lazyGrowth> hazards;
+        detail::hazardDomain::shared().snapshot(hazards);
+        Node* keepFirst = nullptr, * keepLast = nullptr;
+        size_t freed = 0;
+        while (list) {
+            Node* node = list;
+            list = node->retiredNext;
+            if (std::binary_search(hazards.begin(), hazards.end(), static_cast<const void*>(node))) {
+                node->retiredNext = keepFirst;
+                keepFirst = node;
+                if (!keepLast) {
+                    keepLast = node;
+                }
+            } else {
+                destroyNode(node);
+                ++freed;
+            }
+        }
+        retiredCount.fetch_sub(freed, std::memory_order_relaxed);
+        if (keepFirst) {
+            keepLast->retiredNext = retired.load(std::memory_order_relaxed);
+            while (!retired.compare_exchange_weak(keepLast->retiredNext, keepFirst, std::memory_order_release, std::memory_order_relaxed)) {
+
+            }
+        }
+    }
+
+    static size_t pickSlot() noexcept {
+        static thread_local std::uint32_t seed = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&seed) >> 4) | 1;
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed % exchangeSlots;
+    }
+
+    // Offers `node` to a concurrent pop; true if one took it.
+    bool eliminatePush(Node* node) noexcept {
+        std::atomic<std::uintptr_t>& slot = slots[pickSlot()].value;
+        std::uintptr_t expected = 0;
+        const auto offered = reinterpret_cast<std::uintptr_t>(node);
+        if (!slot.compare_exchange_strong(expected, offered, std::memory_order_release, std::memory_order_relaxed)) {
+            return false;
+        }
+        for (size_t i = 0; i < exchangeSpins; ++i) {
+            if (slot.load(std::memory_order_relaxed) == taken) {
+                slot.store(0, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        expected = offered;
+        if (slot.compare_exchange_strong(expected, 0, std::memory_order_relaxed)) {
+            return false;
+        }
+        slot.store(0, std::memory_order_relaxed);
+        return true;
+    }
+
+    // Takes a node offered by a concurrent push, if there is one.
+    bool eliminatePop(T& out) {
+        std::atomic<std::uintptr_t>& slot = slots[pickSlot()].value;
+        std::uintptr_t seen = slot.load(std::memory_order_relaxed);
+        if (seen <= taken || !slot.compare_exchange_strong(seen, taken, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return false;
+        }
+        // The node never reached the stack, so nobody else can hold a reference to it.
+        Node* node = reinterpret_cast<Node*>(seen);
+        out = std::move(node->value);
+        destroyNode(node);
+        return true;
+    }
+
+    void pushNode(Node* node) noexcept {
+        node->next = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+            if constexpr (Elimination) {
+                if (eliminatePush(node)) {
+                    return;
+                }
+            }
+        }
+    }
+
+public:
+    ConcurrentStack() = default;
+
+    explicit ConcurrentStack(const Alloc& a) : alloc(a) {
+
+    }
+
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+    // Must not race with any other member call.
+    ~ConcurrentStack() {
+        for (Node* node = head.load(std::memory_order_relaxed); node; ) {
+            Node* next = node->next;
+            destroyNode(node);
+            node = next;
+        }
+        for (Node* node = retired.load(std::memory_order_relaxed); node; ) {
+            Node* next = node->retiredNext;
+            destroyNode(node);
+            node = next;
+        }
+    }
+
+    [[nodiscard]] bool emptyApprox() const noexcept {
+        return head.load(std::memory_order_relaxed) == nullptr;
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        pushNode(createNode(std::forward<Args>(args)...));
+    }
+
+    void push(const T& value) {
+        emplace(value);
+    }
+
+    void push(T&& value) {
+        emplace(std::move(value));
+    }
+
+    // Moves the top element into `out`; false if the stack was empty.
+    bool tryPop(T& out) {
+        detail::hazardRecord& hazard = detail::hazardDomain::shared().local();
+        Node* node = head.load(std::memory_order_acquire);
+        while (true) {
+            if (!node) {
+                hazard.pointer.store(nullptr, std::memory_order_release);
+                return false;
+            }
+            hazard.pointer.store(node, std::memory_order_seq_cst);
+            if (Node* current = head.load(std::memory_order_seq_cst); current != node) {
+                node = current;
+                continue;
+            }
+            if (head.compare_exchange_strong(node, node->next, std::memory_order_acquire, std::memory_order_acquire)) {
+                break;
+            }
+            if constexpr (Elimination) {
+                hazard.pointer.store(nullptr, std::memory_order_release);
+                if (eliminatePop(out)) {
+                    return true;
+                }
+                node = head.load(std::memory_order_acquire);
+            }
+        }
+        hazard.pointer.store(nullptr, std::memory_order_release);
+        out = std::move(node->value);
+        retire(node);
+        return true;
+    }
+};
+
+}
+
+#endif // CONCURRENTSTACK_H
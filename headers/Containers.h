@@ -5,19 +5,307 @@
 #ifndef CONTAINERS_H
 #define CONTAINERS_H
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
 #include <memory>
+#include <type_traits>
 
 namespace mySTL::containers::detail {
 
+// Fixed rather than `std::hardware_destructive_interference_size`, whose value may differ between
+// translation units built with different tuning flags.
+constexpr size_t cacheLineSize = 64;
+
 struct piecewise_construct_t {
     explicit piecewise_construct_t() = default;
 };
 
 constexpr piecewise_construct_t piecewiseConstruct{};
 
-template<typename T, typename Alloc = std::allocator<T>>
-struct conStorage {
+// A type is trivially relocatable when moving it to a new address and dropping the old bytes is
+// equivalent to move-constructing and destroying it. Specialize for types that own their resources
+// through pointers only (e.g. `Array`, `List`).
+template<typename T>
+struct isTriviallyRelocatable : std::is_trivially_copyable<T> {
+
+};
+
+template<typename T>
+constexpr bool isTriviallyRelocatableV = isTriviallyRelocatable<T>::value;
+
+// An allocator is monotonic when `deallocate` is a no-op and the memory is reclaimed all at once by
+// its owner. Node containers may then drop trivially destructible nodes without visiting them.
+template<typename Alloc>
+struct isMonotonicAlloc : std::false_type {
+
+};
+
+template<typename Alloc>
+constexpr bool isMonotonicAllocV = isMonotonicAlloc<Alloc>::value;
+
+// Read hint for batched lookups; a no-op where the compiler has no builtin.
+inline void prefetch(const void* ptr) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(ptr);
+#else
+    (void)ptr;
+#endif
+}
+
+// Hash tables accept lookups by any `K` when both functors opt in, as with the standard unordered
+// containers; `K` must not be the table's iterator so that `erase(it)` is never hijacked.
+template<typename HashFn, typename KeyEqual, typename K, typename Iter>
+constexpr bool isTransparentV = requires {
+    typename HashFn::is_transparent;
+    typename KeyEqual::is_transparent;
+} && !std::is_convertible_v<const K&, Iter>;
+
+template<typename T, typename Alloc>
+void relocateN(Alloc& alloc, T* first, const size_t nn, T* dest) {
+    using allocTraits = std::allocator_traits<Alloc>;
+    if constexpr (isTriviallyRelocatableV<T>) {
+        if (nn) {
+            std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), nn * sizeof(T));
+        }
+    } else {
+        size_t i = 0;
+        try {
+            for (; i < nn; ++i) {
+                allocTraits::construct(alloc, dest + i, std::move_if_noexcept(first[i]));
+            }
+        } catch (...) {
+            for (size_t j = 0; j < i; ++j) {
+                allocTraits::destroy(alloc, dest + j);
+            }
+            throw;
+        }
+        for (i = 0; i < nn; ++i) {
+            allocTraits::destroy(alloc, first + i);
+        }
+    }
+}
+
+template<typename T, typename InputIt>
+constexpr bool isContiguousSourceV = std::is_pointer_v<InputIt> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<InputIt>>, T>;
+
+template<typename T, typename Alloc, typename InputIt>
+T* constructRange(Alloc& alloc, T* dest, InputIt first, InputIt last) {
+    using allocTraits = std::allocator_traits<Alloc>;
+    if constexpr (std::is_trivially_copyable_v<T> && isContiguousSourceV<T, InputIt>) {
+        const auto nn = static_cast<size_t>(last - first);
+        if (nn) {
+            std::memmove(static_cast<void*>(dest), static_cast<const void*>(first), nn * sizeof(T));
+        }
+        return dest + nn;
+    } else {
+        T* curr = dest;
+        try {
+            for (; first != last; ++first, ++curr) {
+                allocTraits::construct(alloc, curr, *first);
+            }
+        } catch (...) {
+            for (; dest != curr; ++dest) {
+                allocTraits::destroy(alloc, dest);
+            }
+            throw;
+        }
+        return curr;
+    }
+}
+
+template<typename T, typename Alloc>
+void constructFill(Alloc& alloc, T* dest, const size_t nn, const T& value) {
+    using allocTraits = std::allocator_traits<Alloc>;
+    if constexpr (std::is_trivially_copyable_v<T> && sizeof(T) == 1) {
+        unsigned char byte;
+        std::memcpy(&byte, &value, 1);
+        std::memset(static_cast<void*>(dest), byte, nn);
+    } else if constexpr (std::is_trivially_copyable_v<T>) {
+        for (size_t i = 0; i < nn; ++i) {
+            std::memcpy(static_cast<void*>(dest + i), static_cast<const void*>(&value), sizeof(T));
+        }
+    } else {
+        size_t i = 0;
+        try {
+            for (; i < nn; ++i) {
+                allocTraits::construct(alloc, dest + i, value);
+            }
+        } catch (...) {
+            for (size_t j = 0; j < i; ++j) {
+                allocTraits::destroy(alloc, dest + j);
+            }
+            throw;
+        }
+    }
+}
+
+template<typename T, typename Alloc>
+void constructValue(Alloc& alloc, T* dest, const size_t nn) {
+    using allocTraits = std::allocator_traits<Alloc>;
+    if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) {
+        if (nn) {
+            std::memset(static_cast<void*>(dest), 0, nn * sizeof(T));
+        }
+    } else {
+        size_t i = 0;
+        try {
+            for (; i < nn; ++i) {
+                allocTraits::construct(alloc, dest + i);
+            }
+        } catch (...) {
+            for (size_t j = 0; j < i; ++j) {
+                allocTraits::destroy(alloc, dest + j);
+            }
+            throw;
+        }
+    }
+}
+
+constexpr size_t minGrowth = 4;
+
+// Growth policies decide how many elements a storage holds right after default construction
+// (`initial`) and which capacity a full storage moves to (`grow`). An `initial` of 0 defers the
+// first allocation to the first insertion.
+template<size_t Initial = 100>
+struct doublingGrowth {
+    static constexpr size_t initial = Initial;
+
+    static constexpr size_t grow(const size_t cap) noexcept {
+        return cap ? cap << 1 : (Initial ? Initial : minGrowth);
+    }
+};
+
+template<size_t Initial = 0>
+struct oneAndHalfGrowth {
+    static constexpr size_t initial = Initial;
+
+    static constexpr size_t grow(const size_t cap) noexcept {
+        return cap ? cap + (cap > 1 ? cap >> 1 : 1) : (Initial ? Initial : minGrowth);
+    }
+};
+
+template<size_t Chunk = 64, size_t Initial = 0>
+struct chunkGrowth {
+    static_assert(Chunk > 0, "chunkGrowth needs a positive chunk");
+
+    static constexpr size_t initial = Initial;
+
+    static constexpr size_t grow(const size_t cap) noexcept {
+        return cap + Chunk;
+    }
+};
+
+using eagerGrowth = doublingGrowth<>;
+using lazyGrowth = doublingGrowth<0>;
+
+// Range and resize operations shared by `conStorage` and `smallStorage`. `Storage` derives from it
+// and exposes `alloc`, `size`, `capacity`, `storage`, `reserve`, `append_` and `destroyRange` to it
+// as a friend; the two differ only in how `reserve` moves the elements.
+template<typename Storage, typename T, typename Growth>
+struct storageOps {
 private:
+    Storage& self() noexcept {
+        return static_cast<Storage&>(*this);
+    }
+
+public:
+    void growFor(const size_t extra) {
+        Storage& st = self();
+        if (st.size + extra <= st.capacity) {
+            return;
+        }
+        const size_t grown = Growth::grow(st.capacity);
+        st.reserve(grown > st.size + extra ? grown : st.size + extra);
+    }
+
+    template<typename InputIt>
+    void appendRange(InputIt first, InputIt last) {
+        Storage& st = self();
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>) {
+            const auto nn = static_cast<size_t>(std::distance(first, last));
+            if constexpr (isContiguousSourceV<T, InputIt>) {
+                const std::less<const T*> before;
+                if (!before(first, st.storage) && before(first, st.storage + st.size)) {
+                    const size_t offset = first - st.storage;
+                    growFor(nn);
+                    first = st.storage + offset;
+                    last = first + nn;
+                }
+            }
+            growFor(nn);
+            constructRange(st.alloc, st.storage + st.size, first, last);
+            st.size += nn;
+        } else {
+            for (; first != last; ++first) {
+                st.append_(*first);
+            }
+        }
+    }
+
+    template<typename InputIt>
+    void insertRange(const size_t pos, InputIt first, InputIt last) {
+        Storage& st = self();
+        const size_t oldSize = st.size;
+        if constexpr (std::is_trivially_copyable_v<T> && isContiguousSourceV<T, InputIt>) {
+            const std::less<const T*> before;
+            if (before(last, st.storage) || !before(first, st.storage + st.capacity)) {
+                const auto nn = static_cast<size_t>(last - first);
+                growFor(nn);
+                std::memmove(static_cast<void*>(st.storage + pos + nn), static_cast<const void*>(st.storage + pos), (oldSize - pos) * sizeof(T));
+                constructRange(st.alloc, st.storage + pos, first, last);
+                st.size += nn;
+                return;
+            }
+        }
+        appendRange(first, last);
+        std::rotate(st.storage + pos, st.storage + oldSize, st.storage + st.size);
+    }
+
+    void resize(const size_t nn) {
+        Storage& st = self();
+        if (nn <= st.size) {
+            st.destroyRange(st.storage + nn, st.storage + st.size);
+            st.size = nn;
+            return;
+        }
+        growFor(nn - st.size);
+        constructValue(st.alloc, st.storage + st.size, nn - st.size);
+        st.size = nn;
+    }
+
+    void resize(const size_t nn, const T& value) {
+        Storage& st = self();
+        if (nn <= st.size) {
+            st.destroyRange(st.storage + nn, st.storage + st.size);
+            st.size = nn;
+            return;
+        }
+        if (const std::less<const T*> before; !before(&value, st.storage) && before(&value, st.storage + st.size)) {
+            const T copy(value);
+            resize(nn, copy);
+            return;
+        }
+        growFor(nn - st.size);
+        constructFill(st.alloc, st.storage + st.size, nn - st.size, value);
+        st.size = nn;
+    }
+
+    void resizeUninitialized(const size_t nn) {
+        static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>, "resizeUninitialized needs a trivial element type");
+        Storage& st = self();
+        if (nn > st.size) {
+            growFor(nn - st.size);
+        }
+        st.size = nn;
+    }
+};
+
+template<typename T, typename Alloc = std::allocator<T>, typename Growth = eagerGrowth>
+struct conStorage : storageOps<conStorage<T, Alloc, Growth>, T, Growth> {
+private:
+    friend struct storageOps<conStorage, T, Growth>;
+
     using allocTraits = std::allocator_traits<Alloc>;
 
     Alloc alloc;
@@ -40,12 +328,22 @@ private:
     }
 
 public:
-    conStorage() : capacity(100) {
-        size = 0;
-        storage = allocTraits::allocate(alloc, capacity);
+    using allocatorType = Alloc;
+
+    conStorage() : conStorage(Alloc()) {
+
+    }
+
+    explicit conStorage(const Alloc& a) : alloc(a), capacity(Growth::initial) {
+        storage = capacity ? allocTraits::allocate(alloc, capacity) : nullptr;
     }
 
-    conStorage(const conStorage& other) : size(other.size), capacity(other.capacity) {
+    // Starts at exactly `cap` elements instead of `Growth::initial`.
+    conStorage(const Alloc& a, const size_t cap) : alloc(a), capacity(cap) {
+        storage = capacity ? allocTraits::allocate(alloc, capacity) : nullptr;
+    }
+
+    conStorage(const conStorage& other) : alloc(allocTraits::select_on_container_copy_construction(other.alloc)), size(other.size), capacity(other.capacity) {
         if (capacity == 0) {
             storage = nullptr;
             size = 0;
@@ -115,18 +413,13 @@ public:
             return;
         }
         T* newStorage = allocTraits::allocate(alloc, newCap);
-        size_t i = 0;
         try {
-            for (; i < size; ++i) {
-                constructAt(newStorage + i, std::move_if_noexcept(storage[i]));
-            }
+            relocateN(alloc, storage, size, newStorage);
         } catch (...) {
-            destroyRange(newStorage, newStorage + i);
             allocTraits::deallocate(alloc, newStorage, newCap);
             throw;
         }
         if (storage) {
-            destroyRange(storage, storage + size);
             allocTraits::deallocate(alloc, storage, capacity);
         }
         storage = newStorage;
@@ -160,7 +453,7 @@ public:
     template<typename... Args>
     void append_(Args&&... args) {
         if (size == capacity) {
-            reserve(capacity ? capacity << 1 : 100);
+            reserve(Growth::grow(capacity));
         }
         constructAt(storage + size, std::forward<Args>(args)...);
         ++size;
@@ -209,6 +502,455 @@ public:
     }
 };
 
+// Same interface as `conStorage`, but the first N elements live inside the object itself and only
+// larger sizes spill to the heap. Not trivially relocatable: `storage` may point into `buffer`.
+template<typename T, size_t N, typename Alloc = std::allocator<T>, typename Growth = eagerGrowth>
+struct smallStorage : storageOps<smallStorage<T, N, Alloc, Growth>, T, Growth> {
+    static_assert(N > 0, "smallStorage needs at least one inline element");
+
+private:
+    friend struct storageOps<smallStorage, T, Growth>;
+
+    using allocTraits = std::allocator_traits<Alloc>;
+
+    Alloc alloc;
+    size_t size = 0, capacity = N;
+    T* storage;
+    alignas(T) unsigned char buffer[N * sizeof(T)];
+
+    T* inlineData() noexcept {
+        return reinterpret_cast<T*>(buffer);
+    }
+
+    [[nodiscard]] bool isInline() const noexcept {
+        return storage == reinterpret_cast<const T*>(buffer);
+    }
+
+    template<typename... Args>
+    void constructAt(T* ptr, Args&&... args) {
+        allocTraits::construct(alloc, ptr, std::forward<Args>(args)...);
+    }
+
+    void destroyRange(T* first, T* last) noexcept {
+        for (; first != last; ++first) {
+            allocTraits::destroy(alloc, first);
+        }
+    }
+
+    void release() noexcept {
+        destroyRange(storage, storage + size);
+        if (!isInline()) {
+            allocTraits::deallocate(alloc, storage, capacity);
+        }
+        storage = inlineData();
+        size = 0;
+        capacity = N;
+    }
+
+    void steal(smallStorage& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (other.isInline()) {
+            relocateN(alloc, other.storage, other.size, storage);
+            size = other.size;
+            other.size = 0;
+            return;
+        }
+        storage = other.storage;
+        size = other.size;
+        capacity = other.capacity;
+        other.storage = other.inlineData();
+        other.size = 0;
+        other.capacity = N;
+    }
+
+public:
+    using allocatorType = Alloc;
+
+    smallStorage() noexcept : storage(inlineData()) {
+
+    }
+
+    explicit smallStorage(const Alloc& a) noexcept : alloc(a), storage(inlineData()) {
+
+    }
+
+    // Stays inline up to N elements; a larger `cap` is allocated once.
+    smallStorage(const Alloc& a, const size_t cap) : smallStorage(a) {
+        reserve(cap);
+    }
+
+    smallStorage(const smallStorage& other) : alloc(allocTraits::select_on_container_copy_construction(other.alloc)), storage(inlineData()) {
+        try {
+            reserve(other.size);
+            for ( ; size < other.size; ++size) {
+                constructAt(storage + size, other.storage[size]);
+            }
+        } catch (...) {
+            release();
+            throw;
+        }
+    }
+
+    smallStorage& operator=(const smallStorage& other) {
+        if (this == &other) {
+            return *this;
+        }
+        smallStorage tmp(other);
+        swap(tmp);
+        return *this;
+    }
+
+    smallStorage(smallStorage&& other) noexcept(std::is_nothrow_move_constructible_v<T>) : alloc(std::move(other.alloc)), storage(inlineData()) {
+        steal(other);
+    }
+
+    smallStorage& operator=(smallStorage&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this == &other) {
+            return *this;
+        }
+        release();
+        alloc = std::move(other.alloc);
+        steal(other);
+        return *this;
+    }
+
+    ~smallStorage() noexcept {
+        release();
+    }
+
+    void reserve(size_t newCap) {
+        if (newCap < size) {
+            newCap = size;
+        }
+        if (newCap <= N) {
+            if (isInline()) {
+                return;
+            }
+            relocateN(alloc, storage, size, inlineData());
+            allocTraits::deallocate(alloc, storage, capacity);
+            storage = inlineData();
+            capacity = N;
+            return;
+        }
+        if (newCap == capacity) {
+            return;
+        }
+        T* newStorage = allocTraits::allocate(alloc, newCap);
+        try {
+            relocateN(alloc, storage, size, newStorage);
+        } catch (...) {
+            allocTraits::deallocate(alloc, newStorage, newCap);
+            throw;
+        }
+        if (!isInline()) {
+            allocTraits::deallocate(alloc, storage, capacity);
+        }
+        storage = newStorage;
+        capacity = newCap;
+    }
+
+    [[nodiscard]] size_t getSize() const noexcept {
+        return size;
+    }
+
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return capacity;
+    }
+
+    T* getData() noexcept {
+        return storage;
+    }
+
+    const T* getData() const noexcept {
+        return storage;
+    }
+
+    T& operator[](size_t i) noexcept {
+        return storage[i];
+    }
+
+    const T& operator[](size_t i) const noexcept {
+        return storage[i];
+    }
+
+    template<typename... Args>
+    void append_(Args&&... args) {
+        if (size == capacity) {
+            reserve(Growth::grow(capacity));
+        }
+        constructAt(storage + size, std::forward<Args>(args)...);
+        ++size;
+    }
+
+    void append(const T& element) {
+        append_(element);
+    }
+
+    void append(T&& element) {
+        append_(std::move(element));
+    }
+
+    void omit() noexcept {
+        if (!size) {
+            return;
+        }
+        allocTraits::destroy(alloc, storage + --size);
+    }
+
+    void clear() noexcept {
+        destroyRange(storage, storage + size);
+        size = 0;
+    }
+
+    void shrink() {
+        if (size == capacity) {
+            return;
+        }
+        reserve(size);
+    }
+
+    void swap(smallStorage& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this == &other) {
+            return;
+        }
+        smallStorage tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+};
+
+// Circular counterpart of `conStorage` for FIFO use: elements occupy `size` slots starting at `head`
+// and wrap around the end of the buffer, so both ends are O(1). Indices are logical, front first.
+template<typename T, typename Alloc = std::allocator<T>, typename Growth = eagerGrowth>
+struct ringStorage {
+private:
+    using allocTraits = std::allocator_traits<Alloc>;
+
+    Alloc alloc;
+    size_t head = 0, size = 0, capacity = 0;
+    T* storage = nullptr;
+
+    [[nodiscard]] size_t slot(const size_t i) const noexcept {
+        const size_t pos = head + i;
+        return pos < capacity ? pos : pos - capacity;
+    }
+
+    void destroyAll() noexcept {
+        for (size_t i = 0; i < size; ++i) {
+            allocTraits::destroy(alloc, storage + slot(i));
+        }
+    }
+
+    // Moves the live elements into a fresh buffer of `newCap` slots, unwrapped so `head` becomes 0.
+    void regrow(const size_t newCap) {
+        T* newStorage = allocTraits::allocate(alloc, newCap);
+        if constexpr (isTriviallyRelocatableV<T>) {
+            const size_t first = size < capacity - head ? size : capacity - head;
+            if (first) {
+                std::memcpy(static_cast<void*>(newStorage), static_cast<const void*>(storage + head), first * sizeof(T));
+            }
+            if (size > first) {
+                std::memcpy(static_cast<void*>(newStorage + first), static_cast<const void*>(storage), (size - first) * sizeof(T));
+            }
+        } else {
+            size_t i = 0;
+            try {
+                for (; i < size; ++i) {
+                    allocTraits::construct(alloc, newStorage + i, std::move_if_noexcept(storage[slot(i)]));
+                }
+            } catch (...) {
+                for (size_t j = 0; j < i; ++j) {
+                    allocTraits::destroy(alloc, newStorage + j);
+                }
+                allocTraits::deallocate(alloc, newStorage, newCap);
+                throw;
+            }
+            destroyAll();
+        }
+        if (storage) {
+            allocTraits::deallocate(alloc, storage, capacity);
+        }
+        storage = newStorage;
+        capacity = newCap;
+        head = 0;
+    }
+
+public:
+    using allocatorType = Alloc;
+
+    ringStorage() : ringStorage(Alloc()) {
+
+    }
+
+    explicit ringStorage(const Alloc& a) : alloc(a), capacity(Growth::initial) {
+        storage = capacity ? allocTraits::allocate(alloc, capacity) : nullptr;
+    }
+
+    ringStorage(const ringStorage& other) : alloc(allocTraits::select_on_container_copy_construction(other.alloc)) {
+        reserve(other.size);
+        for (size_t i = 0; i < other.size; ++i) {
+            try {
+                allocTraits::construct(alloc, storage + i, other[i]);
+            } catch (...) {
+                destroyAll();
+                allocTraits::deallocate(alloc, storage, capacity);
+                throw;
+            }
+            ++size;
+        }
+    }
+
+    ringStorage& operator=(const ringStorage& other) {
+        if (this == &other) {
+            return *this;
+        }
+        ringStorage tmp(other);
+        swap(tmp);
+        return *this;
+    }
+
+    ringStorage(ringStorage&& other) noexcept
+            : alloc(std::move(other.alloc)), head(other.head), size(other.size), capacity(other.capacity), storage(other.storage) {
+        other.head = other.size = other.capacity = 0;
+        other.storage = nullptr;
+    }
+
+    ringStorage& operator=(ringStorage&& other) noexcept {
+        if (this == &other) {
+            return *this;
+        }
+        ringStorage tmp(std::move(other));
+        swap(tmp);
+        return *this;
+    }
+
+    ~ringStorage() noexcept {
+        if (!storage) {
+            return;
+        }
+        destroyAll();
+        allocTraits::deallocate(alloc, storage, capacity);
+    }
+
+    void reserve(const size_t newCap) {
+        if (newCap > capacity) {
+            regrow(newCap);
+        }
+    }
+
+    void growFor(const size_t extra) {
+        if (size + extra <= capacity) {
+            return;
+        }
+        const size_t grown = Growth::grow(capacity);
+        regrow(grown > size + extra ? grown : size + extra);
+    }
+
+    [[nodiscard]] size_t getSize() const noexcept {
+        return size;
+    }
+
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return capacity;
+    }
+
+    T& operator[](const size_t i) noexcept {
+        return storage[slot(i)];
+    }
+
+    const T& operator[](const size_t i) const noexcept {
+        return storage[slot(i)];
+    }
+
+    template<typename... Args>
+    T& append_(Args&&... args) {
+        if (size == capacity) {
+            // The arguments may refer into the buffer about to be released (e.g. `push(front())`).
+            T value(std::forward<Args>(args)...);
+            growFor(1);
+            T* ptr = storage + slot(size);
+            allocTraits::construct(alloc, ptr, std::move(value));
+            ++size;
+            return *ptr;
+        }
+        T* ptr = storage + slot(size);
+        allocTraits::construct(alloc, ptr, std::forward<Args>(args)...);
+        ++size;
+        return *ptr;
+    }
+
+    void append(const T& element) {
+        append_(element);
+    }
+
+    void append(T&& element) {
+        append_(std::move(element));
+    }
+
+    template<typename InputIt>
+    void appendRange(InputIt first, InputIt last) {
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>) {
+            growFor(static_cast<size_t>(std::distance(first, last)));
+        }
+        for (; first != last; ++first) {
+            append_(*first);
+        }
+    }
+
+    void omitFront() noexcept {
+        if (!size) {
+            return;
+        }
+        allocTraits::destroy(alloc, storage + head);
+        head = slot(1);
+        if (--size == 0) {
+            head = 0;
+        }
+    }
+
+    // Moves up to `nn` elements off the front into `out`; returns how many were taken. Each element
+    // leaves the ring as soon as it is destroyed, so a throwing `out` never leaves a destroyed
+    // element counted.
+    template<typename OutputIt>
+    size_t takeFront(size_t nn, OutputIt out) {
+        if (nn > size) {
+            nn = size;
+        }
+        for (size_t i = 0; i < nn; ++i) {
+            *out = std::move(storage[head]);
+            allocTraits::destroy(alloc, storage + head);
+            head = slot(1);
+            if (--size == 0) {
+                head = 0;
+            }
+            ++out;
+        }
+        return nn;
+    }
+
+    void clear() noexcept {
+        destroyAll();
+        head = size = 0;
+    }
+
+    void swap(ringStorage& other) noexcept {
+        std::swap(alloc, other.alloc);
+        std::swap(head, other.head);
+        std::swap(size, other.size);
+        std::swap(capacity, other.capacity);
+        std::swap(storage, other.storage);
+    }
+};
+
+template<typename T, typename Alloc, typename Growth>
+struct isTriviallyRelocatable<conStorage<T, Alloc, Growth>> : std::bool_constant<std::is_empty_v<Alloc>> {
+
+};
+
+template<typename T, typename Alloc, typename Growth>
+struct isTriviallyRelocatable<ringStorage<T, Alloc, Growth>> : std::bool_constant<std::is_empty_v<Alloc>> {
+
+};
+
 template<typename First, typename Second>
 struct KeyValue {
     First first;
@@ -275,6 +1017,11 @@ private:
     }
 };
 
+template<typename First, typename Second>
+struct isTriviallyRelocatable<KeyValue<First, Second>> : std::bool_constant<isTriviallyRelocatableV<std::remove_const_t<First>> && isTriviallyRelocatableV<std::remove_const_t<Second>>> {
+
+};
+
 template<typename First, typename Second>
 void swap(KeyValue<First, Second>& left, KeyValue<First, Second>& right) noexcept (std::is_nothrow_move_assignable_v<First> && std::is_nothrow_move_assignable_v<Second>) {
     left.swap(right);
@@ -7,17 +7,24 @@
 
 #include <cassert>
 
+#include "ChunkedArray.h"
 #include "List.h"
 
 namespace mySTL::structures {
 
-template<typename T, typename Alloc = std::allocator<T>>
+// `Container` is the backing sequence: `List` by default, or `ChunkedArray` (see `BlockDequeue`).
+template<typename T, typename Alloc = std::allocator<T>, typename Container = containers::List<T, Alloc>>
 class Dequeue {
 private:
-    containers::List<T, Alloc> list;
+    Container list;
 
 public:
     Dequeue() = default;
+
+    explicit Dequeue(const Alloc& alloc) : list(alloc) {
+
+    }
+
     Dequeue(const Dequeue&) = default;
     Dequeue(Dequeue&&) noexcept = default;
     Dequeue& operator=(const Dequeue&) = default;
@@ -87,11 +94,14 @@ public:
     }
 };
 
-template<typename T, typename Alloc>
-void swap(Dequeue<T, Alloc>& left, Dequeue<T, Alloc>& right) noexcept(noexcept(left.swap(right))) {
+template<typename T, typename Alloc, typename Container>
+void swap(Dequeue<T, Alloc, Container>& left, Dequeue<T, Alloc, Container>& right) noexcept(noexcept(left.swap(right))) {
     left.swap(right);
 }
 
+template<typename T, typename Alloc = std::allocator<T>>
+using BlockDequeue = Dequeue<T, Alloc, containers::ChunkedArray<T, Alloc>>;
+
 }
 
 #endif // DEQUEUE_H
@@ -0,0 +1,685 @@
+//
+// Created by Ivor_Aif on 2026/10/18.
+//
+
+#ifndef FLATHASH_H
+#define FLATHASH_H
+
+#include <bit>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Containers.h"
+#include "Hasher.h"
+#include "Simd.h"
+
+namespace mySTL::containers {
+
+namespace detail {
+
+// Control byte per slot: 0..127 holds the low 7 bits of a full slot's hash, anything with the sign
+// bit set is free.
+constexpr std::int8_t ctrlEmpty = -128;
+constexpr std::int8_t ctrlDeleted = -2;
+constexpr size_t groupWidth = 16;
+
+// Sixteen control bytes compared at once; every query returns one bit per slot.
+struct ctrlGroup {
+#if defined(MYSTL_SIMD_X86) && defined(__SSE2__)
+    __m128i bytes;
+
+    explicit ctrlGroup(const std::int8_t* ctrl) noexcept : bytes(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {
+
+    }
+
+    [[nodiscard]] std::uint32_t match(const std::int8_t h2) const noexcept {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(h2))));
+    }
+
+    [[nodiscard]] std::uint32_t matchEmpty() const noexcept {
+        return match(ctrlEmpty);
+    }
+
+    [[nodiscard]] std::uint32_t matchFree() const noexcept {
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(bytes));
+    }
+#else
+    const std::int8_t* bytes;
+
+    explicit ctrlGroup(const std::int8_t* ctrl) noexcept : bytes(ctrl) {
+
+    }
+
+    [[nodiscard]] std::uint32_t match(const std::int8_t h2) const noexcept {
+        std::uint32_t bits = 0;
+        for (size_t i = 0; i < groupWidth; ++i) {
+            bits |= static_cast<std::uint32_t>(bytes[i] == h2) << i;
+        }
+        return bits;
+    }
+
+    [[nodiscard]] std::uint32_t matchEmpty() const noexcept {
+        return match(ctrlEmpty);
+    }
+
+    [[nodiscard]] std::uint32_t matchFree() const noexcept {
+        std::uint32_t bits = 0;
+        for (size_t i = 0; i < groupWidth; ++i) {
+            bits |= static_cast<std::uint32_t>(bytes[i] < 0) << i;
+        }
+        return bits;
+    }
+#endif
+};
+
+}
+
+// Open-addressing hash table in the Swiss-table layout: slots hold the KeyValue pairs inline and a
+// parallel array of control bytes is probed sixteen at a time, so a lookup touches one control
+// group and, usually, one slot. Groups are aligned, which keeps the erase rule simple: a slot goes
+// back to empty when its group still has an empty slot (no probe can have passed through a group
+// that was never full), otherwise it becomes a tombstone.
+//
+// Same interface as `Hash`. References and iterators stay valid until the table rehashes; erasing
+// never moves other elements. The maximum load factor is fixed at 7/8.
+template<typename Key, typename T, typename HashFn = hash::Hasher<Key>, typename KeyEqual = std::equal_to<Key>, typename Alloc = std::allocator<detail::KeyValue<const Key, T>>>
+class FlatHash {
+private:
+    using VT = detail::KeyValue<const Key, T>;
+    using allocTraits = std::allocator_traits<Alloc>;
+    using CtrlAlloc = typename allocTraits::template rebind_alloc<std::int8_t>;
+    using ctrlTraits = std::allocator_traits<CtrlAlloc>;
+
+    static constexpr size_t minCapacity = detail::groupWidth;
+    static constexpr size_t batchChunk = 32;
+
+    Alloc alloc;
+    std::int8_t* ctrl = nullptr;
+    VT* slots = nullptr;
+    size_t capacity = 0;
+    size_t elemCount = 0;
+    // Free slots that may still be filled before the table must grow; tombstones do not count.
+    size_t growthLeft = 0;
+    HashFn hashFn;
+    KeyEqual keyEq;
+
+    static size_t maxElements(const size_t cap) noexcept {
+        return cap - cap / 8;
+    }
+
+    static size_t capacityFor(const size_t count) noexcept {
+        size_t cap = minCapacity;
+        while (maxElements(cap) < count) {
+            cap <<= 1;
+        }
+        return cap;
+    }
+
+    // The control bytes take the low 7 bits and probing the high ones, so a HashFn that is not known
+    // to avalanche (std::hash of an integer is the identity) is mixed first.
+    static std::uint64_t mixHash(const size_t raw) noexcept {
+        if constexpr (hash::isAvalanchingV<HashFn>) {
+            return static_cast<std::uint64_t>(raw);
+        } else {
+            return hash::mix64(static_cast<std::uint64_t>(raw));
+        }
+    }
+
+    template<typename K>
+    std::uint64_t hashOf(const K& key) const {
+        return mixHash(hashFn(key));
+    }
+
+    static std::int8_t h2(const std::uint64_t hash) noexcept {
+        return static_cast<std::int8_t>(hash & 0x7F);
+    }
+
+    [[nodiscard]] bool isFull(const size_t index) const noexcept {
+        return ctrl[index] >= 0;
+    }
+
+    // Visits groups in triangular order, which covers every group when their count is a power of two.
+    struct probe {
+        size_t group;
+        size_t mask;
+        size_t step = 0;
+
+        probe(const std::uint64_t hash, const size_t groups) noexcept : group(static_cast<size_t>(hash >> 7) & (groups - 1)), mask(groups - 1) {
+
+        }
+
+        [[nodiscard]] size_t offset() const noexcept {
+            return group * detail::groupWidth;
+        }
+
+        void next() noexcept {
+            group = (group + ++step) & mask;
+        }
+    };
+
+    template<typename K>
+    size_t findIndex(const K& key, const std::uint64_t hash) const {
+        if (!capacity) {
+            return capacity;
+        }
+        for (probe seq(hash, capacity / detail::groupWidth); ; seq.next()) {
+            const detail::ctrlGroup group(ctrl + seq.offset());
+            for (std::uint32_t bits = group.match(h2(hash)); bits; bits &= bits - 1) {
+                const size_t index = seq.offset() + std::countr_zero(bits);
+                if (keyEq(slots[index].first, key)) {
+                    return index;
+                }
+            }
+            if (group.matchEmpty()) {
+                return capacity;
+            }
+        }
+    }
+
+    size_t findFree(const std::uint64_t hash) const noexcept {
+        for (probe seq(hash, capacity / detail::groupWidth); ; seq.next()) {
+            if (const std::uint32_t bits = detail::ctrlGroup(ctrl + seq.offset()).matchFree()) {
+                return seq.offset() + std::countr_zero(bits);
+            }
+        }
+    }
+
+    void allocateTable(const size_t cap) {
+        CtrlAlloc ctrlAlloc(alloc);
+        ctrl = ctrlTraits::allocate(ctrlAlloc, cap);
+        try {
+            slots = allocTraits::allocate(alloc, cap);
+        } catch (...) {
+            ctrlTraits::deallocate(ctrlAlloc, ctrl, cap);
+            ctrl = nullptr;
+            throw;
+        }
+        std::fill(ctrl, ctrl + cap, detail::ctrlEmpty);
+        capacity = cap;
+        growthLeft = maxElements(cap);
+    }
+
+    void destroyAll() noexcept {
+        for (size_t i = 0; i < capacity; ++i) {
+            if (isFull(i)) {
+                allocTraits::destroy(alloc, slots + i);
+            }
+        }
+    }
+
+    void releaseTable() noexcept {
+        if (!capacity) {
+            return;
+        }
+        destroyAll();
+        CtrlAlloc ctrlAlloc(alloc);
+        ctrlTraits::deallocate(ctrlAlloc, ctrl, capacity);
+        allocTraits::deallocate(alloc, slots, capacity);
+        ctrl = nullptr;
+        slots = nullptr;
+        capacity = elemCount = growthLeft = 0;
+    }
+
+    // Returns the slot to construct a new element for `key` in, growing first if needed.
+    size_t prepareInsert(const std::uint64_t hash) {
+        if (!capacity) {
+            rehash(minCapacity);
+        }
+        size_t index = findFree(hash);
+        if (growthLeft == 0 && ctrl[index] == detail::ctrlEmpty) {
+            // Mostly tombstones: rebuilding at the same size is enough.
+            rehash(elemCount + 1 <= maxElements(capacity) / 2 ? capacity : capacity << 1);
+            index = findFree(hash);
+        }
+        return index;
+    }
+
+    void commitInsert(const size_t index, const std::uint64_t hash) noexcept {
+        if (ctrl[index] == detail::ctrlEmpty) {
+            --growthLeft;
+        }
+        ctrl[index] = h2(hash);
+        ++elemCount;
+    }
+
+    template<typename V>
+    detail::KeyValue<size_t, bool> insertValue(V&& value) {
+        const std::uint64_t hash = hashOf(value.first);
+        if (const size_t found = findIndex(value.first, hash); found != capacity) {
+            return { found, false };
+        }
+        const size_t index = prepareInsert(hash);
+        allocTraits::construct(alloc, slots + index, std::forward<V>(value));
+        commitInsert(index, hash);
+        return { index, true };
+    }
+
+    void eraseAt(const size_t index) noexcept {
+        allocTraits::destroy(alloc, slots + index);
+        const size_t groupStart = index & ~(detail::groupWidth - 1);
+        if (detail::ctrlGroup(ctrl + groupStart).matchEmpty()) {
+            ctrl[index] = detail::ctrlEmpty;
+            ++growthLeft;
+        } else {
+            ctrl[index] = detail::ctrlDeleted;
+        }
+        --elemCount;
+    }
+
+    template<typename K>
+    size_t eraseKey(const K& key) noexcept {
+        const size_t index = findIndex(key, hashOf(key));
+        if (index == capacity) {
+            return 0;
+        }
+        eraseAt(index);
+        return 1;
+    }
+
+    // Hashes a chunk of keys, prefetches each home control group, then each first candidate slot, so
+    // the misses of a whole chunk overlap before `resolve` probes them.
+    template<typename K, typename Resolve>
+    void lookupBatch(const K* keys, const size_t nn, Resolve&& resolve) const {
+        std::uint64_t hashes[batchChunk];
+        const size_t groups = capacity / detail::groupWidth;
+        for (size_t base = 0; base < nn; base += batchChunk) {
+            const size_t count = std::min(batchChunk, nn - base);
+            for (size_t i = 0; i < count; ++i) {
+                hashes[i] = hashOf(keys[base + i]);
+                detail::prefetch(ctrl + probe(hashes[i], groups).offset());
+            }
+            for (size_t i = 0; i < count; ++i) {
+                const size_t offset = probe(hashes[i], groups).offset();
+                if (const std::uint32_t bits = detail::ctrlGroup(ctrl + offset).match(h2(hashes[i]))) {
+                    detail::prefetch(slots + offset + std::countr_zero(bits));
+                }
+            }
+            for (size_t i = 0; i < count; ++i) {
+                resolve(base + i, findIndex(keys[base + i], hashes[i]));
+            }
+        }
+    }
+
+    size_t nextFull(size_t index) const noexcept {
+        while (index < capacity && !isFull(index)) {
+            ++index;
+        }
+        return index;
+    }
+
+public:
+    template<bool IsConst>
+    class IteratorBase;
+    using Iterator = IteratorBase<false>;
+    using ConstIterator = IteratorBase<true>;
+    using InsertResult = detail::KeyValue<Iterator, bool>;
+
+    FlatHash() = default;
+
+    explicit FlatHash(const size_t count, const HashFn& hf = HashFn(), const KeyEqual& eq = KeyEqual(), const Alloc& a = Alloc()) : alloc(a), hashFn(hf), keyEq(eq) {
+        reserve(count);
+    }
+
+    FlatHash(std::initializer_list<VT> init, const size_t count = 0, const HashFn& hf = HashFn(), const KeyEqual& eq = KeyEqual(), const Alloc& a = Alloc()) : FlatHash(count ? count : init.size(), hf, eq, a) {
+        for (const auto& val : init) {
+            insert(val);
+        }
+    }
+
+    template<typename InputIt>
+    FlatHash(InputIt first, InputIt last, const size_t count = 0, const HashFn& hf = HashFn(), const KeyEqual& eq = KeyEqual(), const Alloc& a = Alloc()) : FlatHash(count ? count : static_cast<size_t>(std::distance(first, last)), hf, eq, a) {
+        for ( ; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    // Copies the layout slot for slot, so nothing is rehashed.
+    FlatHash(const FlatHash& other) : alloc(allocTraits::select_on_container_copy_construction(other.alloc)), hashFn(other.hashFn), keyEq(other.keyEq) {
+        if (!other.elemCount) {
+            return;
+        }
+        allocateTable(other.capacity);
+        try {
+            for (size_t i = 0; i < capacity; ++i) {
+                if (other.isFull(i)) {
+                    allocTraits::construct(alloc, slots + i, other.slots[i]);
+                    ctrl[i] = other.ctrl[i];
+                    ++elemCount;
+                } else if (other.ctrl[i] == detail::ctrlDeleted) {
+                    ctrl[i] = detail::ctrlDeleted;
+                }
+            }
+        } catch (...) {
+            releaseTable();
+            throw;
+        }
+        growthLeft = other.growthLeft;
+    }
+
+    FlatHash(FlatHash&& other) noexcept : alloc(other.alloc), hashFn(other.hashFn), keyEq(other.keyEq) {
+        swap(other);
+    }
+
+    FlatHash& operator=(FlatHash other) noexcept(allocTraits::propagate_on_container_swap::value || allocTraits::is_always_equal::value) {
+        swap(other);
+        return *this;
+    }
+
+    ~FlatHash() noexcept {
+        releaseTable();
+    }
+
+    void swap(FlatHash& other) noexcept(allocTraits::propagate_on_container_swap::value || allocTraits::is_always_equal::value) {
+        std::swap(ctrl, other.ctrl);
+        std::swap(slots, other.slots);
+        std::swap(capacity, other.capacity);
+        std::swap(elemCount, other.elemCount);
+        std::swap(growthLeft, other.growthLeft);
+        std::swap(hashFn, other.hashFn);
+        std::swap(keyEq, other.keyEq);
+        if constexpr (allocTraits::propagate_on_container_swap::value) {
+            std::swap(alloc, other.alloc);
+        }
+    }
+
+    [[nodiscard]] size_t getSize() const noexcept {
+        return elemCount;
+    }
+
+    [[nodiscard]] bool isEmpty() const noexcept {
+        return elemCount == 0;
+    }
+
+    // Number of slots.
+    [[nodiscard]] size_t getBucketCount() const noexcept {
+        return capacity;
+    }
+
+    [[nodiscard]] double getLoadFactor() const noexcept {
+        return capacity ? static_cast<double>(elemCount) / static_cast<double>(capacity) : 0.;
+    }
+
+    [[nodiscard]] double getMaxLoadFactor() const noexcept {
+        return 7. / 8.;
+    }
+
+    // Keeps the slot array; every slot becomes empty.
+    void clear() noexcept {
+        destroyAll();
+        std::fill(ctrl, ctrl + capacity, detail::ctrlEmpty);
+        elemCount = 0;
+        growthLeft = maxElements(capacity);
+    }
+
+    void reserve(const size_t count) {
+        if (count > maxElements(capacity)) {
+            rehash(capacityFor(count));
+        }
+    }
+
+    // Rebuilds the table with at least `count` slots (rounded up to a power of two) and no tombstones.
+    void rehash(size_t count) {
+        count = std::max(capacityFor(elemCount), std::bit_ceil(std::max(count, minCapacity)));
+        FlatHash fresh(0, hashFn, keyEq, alloc);
+        fresh.allocateTable(count);
+        for (size_t i = 0; i < capacity; ++i) {
+            if (isFull(i)) {
+                const std::uint64_t hash = hashOf(slots[i].first);
+                const size_t index = fresh.findFree(hash);
+                allocTraits::construct(fresh.alloc, fresh.slots + index, std::move(slots[i]));
+                fresh.commitInsert(index, hash);
+            }
+        }
+        swap(fresh);
+    }
+
+    template<bool IsConst>
+    class IteratorBase {
+        friend class FlatHash;
+
+        template<bool>
+        friend class IteratorBase;
+
+    private:
+        using Owner = std::conditional_t<IsConst, const FlatHash, FlatHash>;
+
+        Owner* owner = nullptr;
+        size_t index = 0;
+
+        IteratorBase(Owner* owner, const size_t index) : owner(owner), index(index) {
+
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = VT;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const VT*, VT*>;
+        using reference = std::conditional_t<IsConst, const VT&, VT&>;
+
+        IteratorBase() = default;
+
+        template<bool OtherConst, std::enable_if_t<IsConst && !OtherConst>* = nullptr>
+        IteratorBase(const IteratorBase<OtherConst>& other) : owner(other.owner), index(other.index) {
+
+        }
+
+        reference operator*() const {
+            return owner->slots[index];
+        }
+
+        pointer operator->() const {
+            return owner->slots + index;
+        }
+
+        IteratorBase& operator++() {
+            index = owner->nextFull(index + 1);
+            return *this;
+        }
+
+        IteratorBase operator++(int) {
+            IteratorBase tmp(*this);
+            ++*this;
+            return tmp;
+        }
+
+        bool operator==(const IteratorBase& other) const {
+            return owner == other.owner && index == other.index;
+        }
+
+        bool operator!=(const IteratorBase& other) const {
+            return !(*this == other);
+        }
+    };
+
+    Iterator begin() noexcept {
+        return Iterator(this, nextFull(0));
+    }
+
+    Iterator end() noexcept {
+        return Iterator(this, capacity);
+    }
+
+    ConstIterator begin() const noexcept {
+        return cBegin();
+    }
+
+    ConstIterator end() const noexcept {
+        return cEnd();
+    }
+
+    ConstIterator cBegin() const noexcept {
+        return ConstIterator(this, nextFull(0));
+    }
+
+    ConstIterator cEnd() const noexcept {
+        return ConstIterator(this, capacity);
+    }
+
+    InsertResult insert(const VT& value) {
+        const auto [index, inserted] = insertValue(value);
+        return { Iterator(this, index), inserted };
+    }
+
+    InsertResult insert(VT&& value) {
+        const auto [index, inserted] = insertValue(std::move(value));
+        return { Iterator(this, index), inserted };
+    }
+
+    template<typename... Args>
+    InsertResult emplace(Args&&... args) {
+        VT value(std::forward<Args>(args)...);
+        return insert(std::move(value));
+    }
+
+    T& operator[](const Key& key) {
+        const std::uint64_t hash = hashOf(key);
+        if (const size_t found = findIndex(key, hash); found != capacity) {
+            return slots[found].second;
+        }
+        const size_t index = prepareInsert(hash);
+        allocTraits::construct(alloc, slots + index, key, T());
+        commitInsert(index, hash);
+        return slots[index].second;
+    }
+
+    T& get(const Key& key) {
+        const size_t index = findIndex(key, hashOf(key));
+        if (index == capacity) {
+            throw std::out_of_range("FlatHash::get");
+        }
+        return slots[index].second;
+    }
+
+    const T& get(const Key& key) const {
+        const size_t index = findIndex(key, hashOf(key));
+        if (index == capacity) {
+            throw std::out_of_range("FlatHash::get");
+        }
+        return slots[index].second;
+    }
+
+    Iterator find(const Key& key) noexcept {
+        return Iterator(this, findIndex(key, hashOf(key)));
+    }
+
+    ConstIterator find(const Key& key) const noexcept {
+        return ConstIterator(this, findIndex(key, hashOf(key)));
+    }
+
+    // `hash` must be `getHashFn()(key)`; lets one hash serve several tables with the same HashFn.
+    Iterator find(const Key& key, const size_t hash) noexcept {
+        return Iterator(this, findIndex(key, mixHash(hash)));
+    }
+
+    ConstIterator find(const Key& key, const size_t hash) const noexcept {
+        return ConstIterator(this, findIndex(key, mixHash(hash)));
+    }
+
+    // Heterogeneous lookups, enabled when both HashFn and KeyEqual declare `is_transparent`.
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    Iterator find(const K& key) noexcept {
+        return Iterator(this, findIndex(key, hashOf(key)));
+    }
+
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    ConstIterator find(const K& key) const noexcept {
+        return ConstIterator(this, findIndex(key, hashOf(key)));
+    }
+
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    Iterator find(const K& key, const size_t hash) noexcept {
+        return Iterator(this, findIndex(key, mixHash(hash)));
+    }
+
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    ConstIterator find(const K& key, const size_t hash) const noexcept {
+        return ConstIterator(this, findIndex(key, mixHash(hash)));
+    }
+
+    bool contains(const Key& key) const noexcept {
+        return findIndex(key, hashOf(key)) != capacity;
+    }
+
+    bool contains(const Key& key, const size_t hash) const noexcept {
+        return findIndex(key, mixHash(hash)) != capacity;
+    }
+
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    bool contains(const K& key) const noexcept {
+        return findIndex(key, hashOf(key)) != capacity;
+    }
+
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    bool contains(const K& key, const size_t hash) const noexcept {
+        return findIndex(key, mixHash(hash)) != capacity;
+    }
+
+    size_t erase(const Key& key) noexcept {
+        return eraseKey(key);
+    }
+
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    size_t erase(const K& key) noexcept {
+        return eraseKey(key);
+    }
+
+    // Looks up `nn` keys at once, writing one iterator (or `end()`) per key to `out`.
+    template<typename K, std::enable_if_t<std::is_same_v<K, Key> || detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    void findBatch(const K* keys, const size_t nn, Iterator* out) noexcept {
+        if (!capacity) {
+            std::fill(out, out + nn, end());
+            return;
+        }
+        lookupBatch(keys, nn, [&](const size_t i, const size_t index) {
+            out[i] = Iterator(this, index);
+        });
+    }
+
+    template<typename K, std::enable_if_t<std::is_same_v<K, Key> || detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    void findBatch(const K* keys, const size_t nn, ConstIterator* out) const noexcept {
+        if (!capacity) {
+            std::fill(out, out + nn, cEnd());
+            return;
+        }
+        lookupBatch(keys, nn, [&](const size_t i, const size_t index) {
+            out[i] = ConstIterator(this, index);
+        });
+    }
+
+    template<typename K, std::enable_if_t<std::is_same_v<K, Key> || detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    void containsBatch(const K* keys, const size_t nn, bool* out) const noexcept {
+        if (!capacity) {
+            std::fill(out, out + nn, false);
+            return;
+        }
+        lookupBatch(keys, nn, [&](const size_t i, const size_t index) {
+            out[i] = index != capacity;
+        });
+    }
+
+    [[nodiscard]] HashFn getHashFn() const {
+        return hashFn;
+    }
+
+    [[nodiscard]] KeyEqual getKeyEq() const {
+        return keyEq;
+    }
+
+    Iterator erase(Iterator pos) noexcept {
+        if (pos == end()) {
+            return pos;
+        }
+        eraseAt(pos.index);
+        return Iterator(this, nextFull(pos.index + 1));
+    }
+};
+
+template<typename Key, typename T, typename HashFn, typename KeyEqual, typename Alloc>
+void swap(FlatHash<Key, T, HashFn, KeyEqual, Alloc>& left, FlatHash<Key, T, HashFn, KeyEqual, Alloc>& right) noexcept(noexcept(left.swap(right))) {
+    left.swap(right);
+}
+
+}
+
+#endif // FLATHASH_H
@@ -5,51 +5,272 @@
 #ifndef HASH_H
 #define HASH_H
 
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <chrono>
+#include <utility>
+
 #include "Array.h"
+#include "Hasher.h"
 #include "List.h"
 
 namespace mySTL::containers {
 
-template<typename Key, typename T, typename HashFn = std::hash<Key>, typename KeyEqual = std::equal_to<Key>, typename Alloc = std::allocator<detail::KeyValue<const Key, T>>>
+namespace detail {
+
+// Lookup and rehash counters for `Hash::getStats`. They exist only when MYSTL_HASH_STATS is
+// defined; otherwise every call below is empty and the member takes no space.
+#ifdef MYSTL_HASH_STATS
+class hashCounters {
+private:
+    // Plain load + store rather than a locked add: const lookups may run concurrently (e.g. under
+    // `ConcurrentHash`'s shared locks), where an increment may then be lost but never races.
+    std::atomic<size_t> lookups{0};
+    std::atomic<size_t> comparisons{0};
+    std::atomic<size_t> rehashes{0};
+    std::atomic<size_t> rehashNanos{0};
+
+    static void bump(std::atomic<size_t>& counter, const size_t by) noexcept {
+        counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+    }
+
+public:
+    struct rehashTimer {
+        hashCounters& owner;
+        std::chrono::steady_clock::time_point start;
+
+        ~rehashTimer() {
+            bump(owner.rehashNanos, static_cast<size_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count()));
+        }
+    };
+
+    hashCounters() = default;
+
+    // Counters describe one table object, so copies start from zero.
+    hashCounters(const hashCounters&) noexcept {
+
+    }
+
+    hashCounters& operator=(const hashCounters&) noexcept {
+        return *this;
+    }
+
+    void lookup(const size_t compared) noexcept {
+        bump(lookups, 1);
+        bump(comparisons, compared);
+    }
+
+    void rehash() noexcept {
+        bump(rehashes, 1);
+    }
+
+    [[nodiscard]] rehashTimer timeRehash() noexcept {
+        return { *this, std::chrono::steady_clock::now() };
+    }
+
+    void reset() noexcept {
+        lookups.store(0, std::memory_order_relaxed);
+        comparisons.store(0, std::memory_order_relaxed);
+        rehashes.store(0, std::memory_order_relaxed);
+        rehashNanos.store(0, std::memory_order_relaxed);
+    }
+
+    template<typename Stats>
+    void fill(Stats& stats) const noexcept {
+        stats.lookups = lookups.load(std::memory_order_relaxed);
+        stats.comparisons = comparisons.load(std::memory_order_relaxed);
+        stats.rehashCount = rehashes.load(std::memory_order_relaxed);
+        stats.rehashTime = std::chrono::nanoseconds(rehashNanos.load(std::memory_order_relaxed));
+    }
+};
+#else
+class hashCounters {
+public:
+    struct rehashTimer {
+
+    };
+
+    void lookup(size_t) noexcept {
+
+    }
+
+    void rehash() noexcept {
+
+    }
+
+    [[nodiscard]] rehashTimer timeRehash() noexcept {
+        return {};
+    }
+
+    void reset() noexcept {
+
+    }
+
+    template<typename Stats>
+    void fill(Stats&) const noexcept {
+
+    }
+};
+#endif
+
+}
+
+// Snapshot returned by `Hash::getStats`. The shape fields are always filled in; the lookup and
+// rehash counters stay zero unless MYSTL_HASH_STATS is defined.
+struct HashStats {
+    // occupancy[k] is the number of buckets holding exactly k entries.
+    Array<size_t> occupancy;
+    size_t maxChain = 0;
+    // Mean length of the non-empty chains.
+    double meanChain = 0.;
+    size_t rehashCount = 0;
+    std::chrono::nanoseconds rehashTime{0};
+    // Counted by find, contains, get, operator[] and the batch lookups.
+    size_t lookups = 0;
+    size_t comparisons = 0;
+
+    [[nodiscard]] double comparisonsPerLookup() const noexcept {
+        return lookups ? static_cast<double>(comparisons) / static_cast<double>(lookups) : 0.;
+    }
+};
+
+template<typename Key, typename T, typename HashFn = hash::Hasher<Key>, typename KeyEqual = std::equal_to<Key>, typename Alloc = std::allocator<detail::KeyValue<const Key, T>>>
 class Hash {
 private:
     using VT = detail::KeyValue<const Key, T>;
+    // Bucket arrays are always sized explicitly, so they skip the default up-front reservation.
+    using Buckets = Array<List<VT, Alloc>, detail::lazyGrowth>;
 
-    Array<List<VT, Alloc>> buckets;
+    Alloc alloc;
+    Buckets buckets;
     size_t elemCount = 0;
     double maxLoadFactor = 1.;
     HashFn hashFn;
     KeyEqual keyEq;
-    Alloc alloc;
+    // Incremental mode. While `oldBucketCount` is non-zero a rehash is in flight: `buckets` is first
+    // built up to `targetBucketCount` lists, then `oldBuckets` is drained from the back into it. A
+    // key lives in old bucket `hash & (oldBucketCount - 1)` until that bucket has been drained.
+    Buckets oldBuckets;
+    size_t oldBucketCount = 0;
+    size_t targetBucketCount = 0;
+    bool incremental = false;
+    [[no_unique_address]] mutable detail::hashCounters counters;
+
+    static constexpr size_t rehashStep = 8;
+    static constexpr size_t batchChunk = 32;
+
+    // Bucket counts are always powers of two so that `bucketIndex` can mask instead of divide.
+    static size_t roundBucketCount(const size_t count) noexcept {
+        return count ? std::bit_ceil(count) : 16;
+    }
 
     size_t bucketIndex(const Key& key, const size_t bucketCount) const {
-        return bucketCount ? static_cast<size_t>(hashFn(key) & bucketCount - 1) : 0;
+        return bucketCount ? static_cast<size_t>(hashFn(key) & (bucketCount - 1)) : 0;
+    }
+
+    [[nodiscard]] bool migrating() const noexcept {
+        return oldBucketCount != 0;
     }
 
-    size_t bucketIndex(const Key& key) const {
-        return bucketIndex(key, buckets.getSize());
+    // Iterators address the new buckets first, then whatever old buckets are left.
+    size_t slotCount() const noexcept {
+        return buckets.getSize() + oldBuckets.getSize();
+    }
+
+    List<VT, Alloc>& bucketAt(const size_t slot) noexcept {
+        return slot < buckets.getSize() ? buckets[slot] : oldBuckets[slot - buckets.getSize()];
+    }
+
+    const List<VT, Alloc>& bucketAt(const size_t slot) const noexcept {
+        return slot < buckets.getSize() ? buckets[slot] : oldBuckets[slot - buckets.getSize()];
+    }
+
+    size_t slotFor(const size_t hash) const noexcept {
+        if (migrating()) {
+            if (const size_t old = hash & (oldBucketCount - 1); old < oldBuckets.getSize()) {
+                return buckets.getSize() + old;
+            }
+            return hash & (targetBucketCount - 1);
+        }
+        return buckets.getSize() ? hash & (buckets.getSize() - 1) : 0;
     }
 
     void clearBuckets() noexcept {
-        for (size_t i = 0; i < buckets.getSize(); ++i) {
-            buckets[i].clear();
+        for (size_t i = 0; i < slotCount(); ++i) {
+            bucketAt(i).clear();
         }
         elemCount = 0;
     }
 
+    void startRehash(const size_t newBucketCount) {
+        counters.rehash();
+        buckets.swap(oldBuckets);
+        oldBucketCount = oldBuckets.getSize();
+        targetBucketCount = newBucketCount;
+        buckets.reserve(newBucketCount);
+        stepRehash();
+    }
+
+    // Drains up to `budget` old buckets, newest first, so each one is freed as soon as it is empty.
+    void drainBuckets(size_t budget) noexcept {
+        if (buckets.getSize() != targetBucketCount) {
+            return;
+        }
+        for ( ; budget && !oldBuckets.empty(); --budget) {
+            List<VT, Alloc>& bucket = oldBuckets[oldBuckets.getSize() - 1];
+            while (!bucket.empty()) {
+                List<VT, Alloc>& target = buckets[bucketIndex(bucket.front().first, targetBucketCount)];
+                target.splice(target.end(), bucket, bucket.begin());
+            }
+            oldBuckets.popBack();
+        }
+        if (oldBuckets.empty()) {
+            Buckets().swap(oldBuckets);
+            oldBucketCount = 0;
+        }
+    }
+
+    void stepRehash() {
+        [[maybe_unused]] auto timer = counters.timeRehash();
+        size_t budget = rehashStep;
+        for ( ; budget && buckets.getSize() < targetBucketCount; --budget) {
+            buckets.emplaceBack(alloc);
+        }
+        drainBuckets(budget);
+    }
+
+    void finishRehash() {
+        while (migrating()) {
+            stepRehash();
+        }
+    }
+
     void rehashIfNeeded() {
+        if (migrating()) {
+            stepRehash();
+            return;
+        }
         const size_t bucketCountValue = buckets.getSize();
         if (!bucketCountValue) {
             rehash(16);
             return;
         }
         if (static_cast<double>(elemCount + 1) > maxLoadFactor * static_cast<double>(bucketCountValue)) {
-            rehash(bucketCountValue << 1);
+            if (incremental) {
+                startRehash(bucketCountValue << 1);
+            } else {
+                rehash(bucketCountValue << 1);
+            }
         }
     }
 
     void moveFrom(Hash& other) noexcept {
         buckets.swap(other.buckets);
+        oldBuckets.swap(other.oldBuckets);
+        std::swap(oldBucketCount, other.oldBucketCount);
+        std::swap(targetBucketCount, other.targetBucketCount);
+        std::swap(incremental, other.incremental);
         std::swap(elemCount, other.elemCount);
         std::swap(maxLoadFactor, other.maxLoadFactor);
         std::swap(hashFn, other.hashFn);
@@ -64,15 +285,83 @@ public:
     class ConstIterator;
     using InsertResult = detail::KeyValue<Iterator, bool>;
 
-    Hash() : buckets(16, List<VT, Alloc>()) {
+    // Owns one entry taken out of a table by `extract`. Handing it to `insert` relinks the same
+    // node, so an entry moves between tables without being copied, freed or allocated again. The
+    // two tables' allocators must compare equal.
+    class NodeHandle {
+        friend class Hash;
+
+    private:
+        using nodeOps = detail::lstOps<VT, Alloc>;
+
+        detail::lstNode<VT>* node = nullptr;
+        typename nodeOps::nodeAlloc alloc;
+
+        NodeHandle(detail::lstNode<VT>* node, const Alloc& a) : node(node), alloc(a) {
+
+        }
+
+        detail::lstNode<VT>* release() noexcept {
+            return std::exchange(node, nullptr);
+        }
+
+    public:
+        NodeHandle() = default;
+
+        NodeHandle(NodeHandle&& other) noexcept : node(other.release()), alloc(other.alloc) {
+
+        }
+
+        NodeHandle& operator=(NodeHandle&& other) noexcept {
+            if (this != &other) {
+                reset();
+                node = other.release();
+                alloc = other.alloc;
+            }
+            return *this;
+        }
+
+        NodeHandle(const NodeHandle&) = delete;
+        NodeHandle& operator=(const NodeHandle&) = delete;
+
+        ~NodeHandle() {
+            reset();
+        }
+
+        [[nodiscard]] bool empty() const noexcept {
+            return node == nullptr;
+        }
+
+        explicit operator bool() const noexcept {
+            return node != nullptr;
+        }
+
+        const Key& key() const {
+            assert(node);
+            return node->value.first;
+        }
+
+        T& mapped() const {
+            assert(node);
+            return node->value.second;
+        }
+
+        void reset() noexcept {
+            if (node) {
+                nodeOps::destroy(alloc, release());
+            }
+        }
+    };
+
+    Hash() : buckets(16, List<VT, Alloc>(alloc)) {
 
     }
 
-    explicit Hash(size_t bucketCount, const HashFn& hf = HashFn(), const KeyEqual& eq = KeyEqual(), const Alloc& a = Alloc()) : buckets(bucketCount ? bucketCount : 16, List<VT, Alloc>()), hashFn(hf), keyEq(eq), alloc(a) {
+    explicit Hash(size_t bucketCount, const HashFn& hf = HashFn(), const KeyEqual& eq = KeyEqual(), const Alloc& a = Alloc()) : alloc(a), buckets(roundBucketCount(bucketCount), List<VT, Alloc>(alloc)), hashFn(hf), keyEq(eq) {
     
     }
 
-    Hash(std::initializer_list<VT> init, size_t bucketCount = 0, const HashFn& hf = HashFn(), const KeyEqual& eq = KeyEqual(), const Alloc& alloc = Alloc()) : Hash(bucketCount ? bucketCount : init.getSize(), hf, eq, alloc) {
+    Hash(std::initializer_list<VT> init, size_t bucketCount = 0, const HashFn& hf = HashFn(), const KeyEqual& eq = KeyEqual(), const Alloc& alloc = Alloc()) : Hash(bucketCount ? bucketCount : init.size(), hf, eq, alloc) {
         for (const auto& val : init) {
             insert(val);
         }
@@ -85,13 +374,13 @@ public:
         }
     }
 
-    Hash(const Hash& other) : buckets(other.buckets.getSize() ? other.buckets.getSize() : 16, List<VT, Alloc>()), maxLoadFactor(other.maxLoadFactor), hashFn(other.hashFn), keyEq(other.keyEq), alloc(std::allocator_traits<Alloc>::select_on_container_copy_construction(other.alloc)) {
+    Hash(const Hash& other) : alloc(std::allocator_traits<Alloc>::select_on_container_copy_construction(other.alloc)), buckets(other.getBucketCount() ? other.getBucketCount() : 16, List<VT, Alloc>(alloc)), maxLoadFactor(other.maxLoadFactor), hashFn(other.hashFn), keyEq(other.keyEq), incremental(other.incremental) {
         for (const auto& val : other) {
             insert(val);
         }
     }
 
-    Hash(Hash&& other) noexcept : buckets(0, List<VT, Alloc>()), hashFn(other.hashFn), keyEq(other.keyEq), alloc(std::move(other.alloc)) {
+    Hash(Hash&& other) noexcept : alloc(other.alloc), buckets(0, List<VT, Alloc>(alloc)), hashFn(other.hashFn), keyEq(other.keyEq) {
         moveFrom(other);
     }
 
@@ -106,6 +395,10 @@ public:
 
     void swap(Hash& other) noexcept(std::allocator_traits<Alloc>::propagate_on_container_swap::value || std::allocator_traits<Alloc>::is_always_equal::value) {
         buckets.swap(other.buckets);
+        oldBuckets.swap(other.oldBuckets);
+        std::swap(oldBucketCount, other.oldBucketCount);
+        std::swap(targetBucketCount, other.targetBucketCount);
+        std::swap(incremental, other.incremental);
         std::swap(elemCount, other.elemCount);
         std::swap(maxLoadFactor, other.maxLoadFactor);
         std::swap(hashFn, other.hashFn);
@@ -124,11 +417,11 @@ public:
     }
 
     [[nodiscard]] size_t getBucketCount() const noexcept {
-        return buckets.getSize();
+        return migrating() ? targetBucketCount : buckets.getSize();
     }
 
     [[nodiscard]] double getLoadFactor() const noexcept {
-        const size_t bc = buckets.getSize();
+        const size_t bc = getBucketCount();
         if (!bc) {
             return 0.;
         }
@@ -150,7 +443,26 @@ public:
         clearBuckets();
     }
 
+    // Opt-in: once the table is over its load factor, each insert or erase moves a few buckets into
+    // a table of twice the size instead of rehashing everything in one step. Lookups check both
+    // tables while a move is in flight; turning the mode off completes it.
+    void setIncrementalRehash(const bool on) {
+        if (!on) {
+            finishRehash();
+        }
+        incremental = on;
+    }
+
+    [[nodiscard]] bool getIncrementalRehash() const noexcept {
+        return incremental;
+    }
+
+    [[nodiscard]] bool isRehashing() const noexcept {
+        return migrating();
+    }
+
     void reserve(const size_t count) {
+        finishRehash();
         const size_t bc = buckets.getSize();
         const double lf = maxLoadFactor;
         if (const size_t required = static_cast<size_t>(static_cast<double>(count) / lf) + 1; required > bc) {
@@ -158,19 +470,36 @@ public:
         }
     }
 
-    void rehash(size_t newBucketCount) {
-        if (newBucketCount == 0) {
-            newBucketCount = 16;
+    // Resizes the bucket array in place and relinks only the nodes whose bucket changes; nothing is
+    // allocated per element. With power-of-two counts, growing can only move a node from bucket i to
+    // some j >= old count, and shrinking folds bucket i into i & (new count - 1).
+    void rehash(const size_t bucketCount) {
+        finishRehash();
+        const size_t newBucketCount = roundBucketCount(bucketCount);
+        const size_t oldBucketCount = buckets.getSize();
+        if (newBucketCount == oldBucketCount) {
+            return;
+        }
+        counters.rehash();
+        [[maybe_unused]] auto timer = counters.timeRehash();
+        if (newBucketCount < oldBucketCount) {
+            for (size_t i = newBucketCount; i < oldBucketCount; ++i) {
+                List<VT, Alloc>& target = buckets[i & (newBucketCount - 1)];
+                target.splice(target.end(), buckets[i]);
+            }
+            buckets.resize(newBucketCount, List<VT, Alloc>(alloc));
+            return;
         }
-        Array<List<VT, Alloc>> newBuckets(newBucketCount, List<VT, Alloc>());
-        for (size_t i = 0; i < buckets.getSize(); ++i) {
+        buckets.resize(newBucketCount, List<VT, Alloc>(alloc));
+        for (size_t i = 0; i < oldBucketCount; ++i) {
             List<VT, Alloc>& bucket = buckets[i];
-            for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-                auto idx = static_cast<size_t>(hashFn(it->first) % newBucketCount);
-                newBuckets[idx].pushBack(std::move(*it));
+            for (auto it = bucket.begin(); it != bucket.end(); ) {
+                auto node = it++;
+                if (const size_t index = bucketIndex(node->first, newBucketCount); index != i) {
+                    buckets[index].splice(buckets[index].end(), bucket, node);
+                }
             }
         }
-        buckets.swap(newBuckets);
     }
 
     class Iterator {
@@ -189,18 +518,18 @@ public:
             if (!owner) {
                 return;
             }
-            const size_t bucketSize = owner->buckets.getSize();
+            const size_t bucketSize = owner->slotCount();
             if (index >= bucketSize) {
                 return;
             }
-            if (List<VT, Alloc>& bucket = owner->buckets[index]; it != bucket.end()) {
+            if (List<VT, Alloc>& bucket = owner->bucketAt(index); it != bucket.end()) {
                 ++it;
                 if (it != bucket.end()) {
                     return;
                 }
             }
             for (size_t i = index + 1; i < bucketSize; ++i) {
-                if (List<VT, Alloc>& nextBucket = owner->buckets[i]; !nextBucket.empty()) {
+                if (List<VT, Alloc>& nextBucket = owner->bucketAt(i); !nextBucket.empty()) {
                     index = i;
                     it = nextBucket.begin();
                     return;
@@ -256,18 +585,18 @@ public:
             if (!owner) {
                 return;
             }
-            const size_t bucketSize = owner->buckets.getSize();
+            const size_t bucketSize = owner->slotCount();
             if (index >= bucketSize) {
                 return;
             }
-            if (const List<VT, Alloc>& bucket = owner->buckets[index]; it != bucket.endConst()) {
+            if (const List<VT, Alloc>& bucket = owner->bucketAt(index); it != bucket.endConst()) {
                 ++it;
                 if (it != bucket.endConst()) {
                     return;
                 }
             }
             for (size_t i = index + 1; i < bucketSize; ++i) {
-                if (const List<VT, Alloc>& nextBucket = owner->buckets[i]; !nextBucket.empty()) {
+                if (const List<VT, Alloc>& nextBucket = owner->bucketAt(i); !nextBucket.empty()) {
                     index = i;
                     it = nextBucket.beginConst();
                     return;
@@ -313,9 +642,9 @@ public:
     };
 
     Iterator begin() noexcept {
-        const size_t bucketSize = buckets.getSize();
+        const size_t bucketSize = slotCount();
         for (size_t i = 0; i < bucketSize; ++i) {
-            if (List<VT, Alloc>& bucket = buckets[i]; !bucket.empty()) {
+            if (List<VT, Alloc>& bucket = bucketAt(i); !bucket.empty()) {
                 return Iterator(this, i, bucket.begin());
             }
         }
@@ -323,7 +652,7 @@ public:
     }
 
     Iterator end() noexcept {
-        return Iterator(this, buckets.getSize(), detail::lstIterator<VT>{});
+        return Iterator(this, slotCount(), detail::lstIterator<VT>{});
     }
 
     ConstIterator begin() const noexcept {
@@ -335,9 +664,9 @@ public:
     }
 
     ConstIterator cBegin() const noexcept {
-        const size_t bucketSize = buckets.getSize();
+        const size_t bucketSize = slotCount();
         for (size_t i = 0; i < bucketSize; ++i) {
-            if (const List<VT, Alloc>& bucket = buckets[i]; !bucket.empty()) {
+            if (const List<VT, Alloc>& bucket = bucketAt(i); !bucket.empty()) {
                 return ConstIterator(this, i, bucket.beginConst());
             }
         }
@@ -345,13 +674,13 @@ public:
     }
 
     ConstIterator cEnd() const noexcept {
-        return ConstIterator(this, buckets.getSize(), detail::lstConstIterator<VT>{});
+        return ConstIterator(this, slotCount(), detail::lstConstIterator<VT>{});
     }
 
     InsertResult insert(const VT& value) {
         rehashIfNeeded();
-        size_t index = bucketIndex(value.first);
-        List<VT, Alloc>& bucket = buckets[index];
+        size_t index = slotFor(hashFn(value.first));
+        List<VT, Alloc>& bucket = bucketAt(index);
         for (auto it = bucket.begin(); it != bucket.end(); ++it) {
             if (keyEq(it->first, value.first)) {
                 return { Iterator(this, index, it), false };
@@ -366,8 +695,8 @@ public:
 
     InsertResult insert(VT&& value) {
         rehashIfNeeded();
-        size_t index = bucketIndex(value.first);
-        List<VT, Alloc>& bucket = buckets[index];
+        size_t index = slotFor(hashFn(value.first));
+        List<VT, Alloc>& bucket = bucketAt(index);
         for (auto it = bucket.begin(); it != bucket.end(); ++it) {
             if (keyEq(it->first, value.first)) {
                 return { Iterator(this, index, it), false };
@@ -411,51 +740,197 @@ public:
     }
 
     Iterator find(const Key& key) noexcept {
-        if (const size_t bucketSize = buckets.getSize(); !bucketSize) {
-            return end();
+        return findHashed(key, hashFn(key));
+    }
+
+    ConstIterator find(const Key& key) const noexcept {
+        return findHashed(key, hashFn(key));
+    }
+
+    // `hash` must be `getHashFn()(key)`; lets one hash serve several tables with the same HashFn.
+    Iterator find(const Key& key, const size_t hash) noexcept {
+        return findHashed(key, hash);
+    }
+
+    ConstIterator find(const Key& key, const size_t hash) const noexcept {
+        return findHashed(key, hash);
+    }
+
+    // Heterogeneous lookups, enabled when both HashFn and KeyEqual declare `is_transparent`.
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    Iterator find(const K& key) noexcept {
+        return findHashed(key, hashFn(key));
+    }
+
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    ConstIterator find(const K& key) const noexcept {
+        return findHashed(key, hashFn(key));
+    }
+
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    Iterator find(const K& key, const size_t hash) noexcept {
+        return findHashed(key, hash);
+    }
+
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    ConstIterator find(const K& key, const size_t hash) const noexcept {
+        return findHashed(key, hash);
+    }
+
+    bool contains(const Key& key) const noexcept {
+        return find(key) != cEnd();
+    }
+
+    bool contains(const Key& key, const size_t hash) const noexcept {
+        return findHashed(key, hash) != cEnd();
+    }
+
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    bool contains(const K& key) const noexcept {
+        return findHashed(key, hashFn(key)) != cEnd();
+    }
+
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    bool contains(const K& key, const size_t hash) const noexcept {
+        return findHashed(key, hash) != cEnd();
+    }
+
+    size_t erase(const Key& key) noexcept {
+        return eraseHashed(key, hashFn(key));
+    }
+
+    template<typename K, std::enable_if_t<detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    size_t erase(const K& key) noexcept {
+        return eraseHashed(key, hashFn(key));
+    }
+
+    // Looks up `nn` keys at once, writing one iterator (or `end()`) per key to `out`. On tables
+    // much larger than the cache this overlaps the misses that a loop of `find` takes one by one.
+    template<typename K, std::enable_if_t<std::is_same_v<K, Key> || detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    void findBatch(const K* keys, const size_t nn, Iterator* out) noexcept {
+        if (!slotCount()) {
+            std::fill(out, out + nn, end());
+            return;
         }
-        size_t index = bucketIndex(key);
-        List<VT, Alloc>& bucket = buckets[index];
-        for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-            if (keyEq(it->first, key)) {
-                return Iterator(this, index, it);
-            }
+        lookupBatch(keys, nn, [&](const size_t i, const size_t slot) {
+            out[i] = findInSlot(keys[i], slot);
+        });
+    }
+
+    template<typename K, std::enable_if_t<std::is_same_v<K, Key> || detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    void findBatch(const K* keys, const size_t nn, ConstIterator* out) const noexcept {
+        if (!slotCount()) {
+            std::fill(out, out + nn, cEnd());
+            return;
         }
-        return end();
+        lookupBatch(keys, nn, [&](const size_t i, const size_t slot) {
+            out[i] = findInSlot(keys[i], slot);
+        });
     }
 
-    ConstIterator find(const Key& key) const noexcept {
-        if (const size_t bucketSize = buckets.getSize(); !bucketSize) {
-            return cEnd();
+    template<typename K, std::enable_if_t<std::is_same_v<K, Key> || detail::isTransparentV<HashFn, KeyEqual, K, Iterator>>* = nullptr>
+    void containsBatch(const K* keys, const size_t nn, bool* out) const noexcept {
+        if (!slotCount()) {
+            std::fill(out, out + nn, false);
+            return;
         }
-        size_t index = bucketIndex(key);
-        const List<VT, Alloc>& bucket = buckets[index];
-        for (auto it = bucket.beginConst(); it != bucket.endConst(); ++it) {
-            if (keyEq(it->first, key)) {
-                return ConstIterator(this, index, it);
+        lookupBatch(keys, nn, [&](const size_t i, const size_t slot) {
+            out[i] = findInSlot(keys[i], slot) != cEnd();
+        });
+    }
+
+    // Bucket occupancy and chain lengths are measured on the spot, in O(bucket count). Tables with
+    // many long chains next to empty buckets point at a weak HashFn; a high mean chain at a sensible
+    // spread points at `setMaxLoadFactor`.
+    [[nodiscard]] HashStats getStats() const {
+        HashStats stats;
+        size_t used = 0;
+        for (size_t i = 0; i < slotCount(); ++i) {
+            const size_t chain = bucketAt(i).length();
+            if (chain >= stats.occupancy.getSize()) {
+                stats.occupancy.resize(chain + 1, 0);
             }
+            ++stats.occupancy[chain];
+            stats.maxChain = std::max(stats.maxChain, chain);
+            used += chain != 0;
         }
-        return cEnd();
+        stats.meanChain = used ? static_cast<double>(elemCount) / static_cast<double>(used) : 0.;
+        counters.fill(stats);
+        return stats;
     }
 
-    bool contains(const Key& key) const noexcept {
-        return find(key) != cEnd();
+    void resetStats() noexcept {
+        counters.reset();
     }
 
-    size_t erase(const Key& key) noexcept {
-        if (const size_t bucketSize = buckets.getSize(); !bucketSize) {
-            return 0;
+    [[nodiscard]] HashFn getHashFn() const {
+        return hashFn;
+    }
+
+    [[nodiscard]] KeyEqual getKeyEq() const {
+        return keyEq;
+    }
+
+    // Unlinks the entry under `key` into a handle; an empty handle if there is none.
+    NodeHandle extract(const Key& key) noexcept {
+        drainStep();
+        return extract(findHashed(key, hashFn(key)));
+    }
+
+    NodeHandle extract(Iterator pos) noexcept {
+        if (pos == end()) {
+            return NodeHandle(nullptr, alloc);
         }
-        size_t index = bucketIndex(key);
-        List<VT, Alloc>& bucket = buckets[index];
+        detail::lstNode<VT>* node = bucketAt(pos.index).release(pos.it);
+        --elemCount;
+        return NodeHandle(node, alloc);
+    }
+
+    // Links the handle's node in if its key is absent and empties the handle. If the key is already
+    // present the handle keeps its node and the result points at the existing entry.
+    InsertResult insert(NodeHandle&& handle) {
+        if (!handle) {
+            return { end(), false };
+        }
+        rehashIfNeeded();
+        const size_t index = slotFor(hashFn(handle.key()));
+        List<VT, Alloc>& bucket = bucketAt(index);
         for (auto it = bucket.begin(); it != bucket.end(); ++it) {
-            if (keyEq(it->first, key)) {
-                bucket.erase(it);
-                --elemCount;
-                return 1;
+            if (keyEq(it->first, handle.key())) {
+                return { Iterator(this, index, it), false };
             }
         }
-        return 0;
+        auto it = bucket.adopt(bucket.end(), handle.release());
+        ++elemCount;
+        return { Iterator(this, index, it), true };
+    }
+
+    // Moves every entry of `other` whose key is absent here by relinking its node; entries with a
+    // key already present stay in `other`. The allocators must compare equal.
+    void merge(Hash& other) {
+        if (this == &other) {
+            return;
+        }
+        assert(alloc == other.alloc);
+        for (size_t i = 0; i < other.slotCount(); ++i) {
+            List<VT, Alloc>& source = other.bucketAt(i);
+            for (auto it = source.begin(); it != source.end(); ) {
+                auto node = it++;
+                const size_t hash = hashFn(node->first);
+                if (findHashed(node->first, hash) != end()) {
+                    continue;
+                }
+                rehashIfNeeded();
+                List<VT, Alloc>& target = bucketAt(slotFor(hash));
+                target.splice(target.end(), source, node);
+                --other.elemCount;
+                ++elemCount;
+            }
+        }
+    }
+
+    void merge(Hash&& other) {
+        merge(other);
     }
 
     Iterator erase(Iterator pos) noexcept {
@@ -463,20 +938,110 @@ public:
             return pos;
         }
         size_t index = pos.index;
-        List<VT, Alloc>& bucket = buckets[index];
+        List<VT, Alloc>& bucket = bucketAt(index);
         detail::lstIterator<VT> nextIt = bucket.erase(pos.it);
         --elemCount;
         if (nextIt != bucket.end()) {
             return Iterator(this, index, nextIt);
         }
-        const size_t bucketSize = buckets.getSize();
+        const size_t bucketSize = slotCount();
         for (size_t i = index + 1; i < bucketSize; ++i) {
-            if (List<VT, Alloc>& nextBucket = buckets[i]; !nextBucket.empty()) {
+            if (List<VT, Alloc>& nextBucket = bucketAt(i); !nextBucket.empty()) {
                 return Iterator(this, i, nextBucket.begin());
             }
         }
         return end();
     }
+
+private:
+    template<typename K>
+    Iterator findInSlot(const K& key, const size_t index) noexcept {
+        List<VT, Alloc>& bucket = bucketAt(index);
+        size_t compared = 0;
+        for (auto it = bucket.begin(); it != bucket.end(); ++it) {
+            ++compared;
+            if (keyEq(it->first, key)) {
+                counters.lookup(compared);
+                return Iterator(this, index, it);
+            }
+        }
+        counters.lookup(compared);
+        return end();
+    }
+
+    template<typename K>
+    ConstIterator findInSlot(const K& key, const size_t index) const noexcept {
+        const List<VT, Alloc>& bucket = bucketAt(index);
+        size_t compared = 0;
+        for (auto it = bucket.beginConst(); it != bucket.endConst(); ++it) {
+            ++compared;
+            if (keyEq(it->first, key)) {
+                counters.lookup(compared);
+                return ConstIterator(this, index, it);
+            }
+        }
+        counters.lookup(compared);
+        return cEnd();
+    }
+
+    template<typename K>
+    Iterator findHashed(const K& key, const size_t hash) noexcept {
+        return slotCount() ? findInSlot(key, slotFor(hash)) : end();
+    }
+
+    template<typename K>
+    ConstIterator findHashed(const K& key, const size_t hash) const noexcept {
+        return slotCount() ? findInSlot(key, slotFor(hash)) : cEnd();
+    }
+
+    // Hashes a chunk of keys, then touches each key's bucket, list sentinel and first node one pass
+    // apart, so the misses of a whole chunk are in flight together before `resolve` walks them.
+    template<typename K, typename Resolve>
+    void lookupBatch(const K* keys, const size_t nn, Resolve&& resolve) const {
+        size_t slots[batchChunk];
+        for (size_t base = 0; base < nn; base += batchChunk) {
+            const size_t count = std::min(batchChunk, nn - base);
+            for (size_t i = 0; i < count; ++i) {
+                slots[i] = slotFor(hashFn(keys[base + i]));
+                detail::prefetch(&bucketAt(slots[i]));
+            }
+            for (size_t i = 0; i < count; ++i) {
+                detail::prefetch(bucketAt(slots[i]).endConst().curr);
+            }
+            for (size_t i = 0; i < count; ++i) {
+                detail::prefetch(bucketAt(slots[i]).beginConst().curr);
+            }
+            for (size_t i = 0; i < count; ++i) {
+                resolve(base + i, slots[i]);
+            }
+        }
+    }
+
+    // Removals only drain old buckets: they allocate nothing, so they can stay noexcept.
+    void drainStep() noexcept {
+        if (migrating()) {
+            [[maybe_unused]] auto timer = counters.timeRehash();
+            drainBuckets(rehashStep);
+        }
+    }
+
+    template<typename K>
+    size_t eraseHashed(const K& key, const size_t hash) noexcept {
+        drainStep();
+        if (!slotCount()) {
+            return 0;
+        }
+        const size_t index = slotFor(hash);
+        List<VT, Alloc>& bucket = bucketAt(index);
+        for (auto it = bucket.begin(); it != bucket.end(); ++it) {
+            if (keyEq(it->first, key)) {
+                bucket.erase(it);
+                --elemCount;
+                return 1;
+            }
+        }
+        return 0;
+    }
 };
 
 }
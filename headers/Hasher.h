@@ -0,0 +1,157 @@
+//
+// Created by Ivor_Aif on 2026/10/18.
+//
+
+#ifndef HASHER_H
+#define HASHER_H
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+namespace mySTL::hash {
+
+namespace detail {
+
+// wyhash's default secret (wyhash final version 4).
+constexpr std::uint64_t secret[4] = {
+    0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+};
+
+// Full 64 x 64 -> 128 bit product, split into its low and high halves.
+inline void multiply(const std::uint64_t a, const std::uint64_t b, std::uint64_t& lo, std::uint64_t& hi) noexcept {
+#ifdef __SIZEOF_INT128__
+    const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+    lo = static_cast<std::uint64_t>(product);
+    hi = static_cast<std::uint64_t>(product >> 64);
+#else
+    const std::uint64_t aHi = a >> 32, aLo = static_cast<std::uint32_t>(a);
+    const std::uint64_t bHi = b >> 32, bLo = static_cast<std::uint32_t>(b);
+    const std::uint64_t hh = aHi * bHi, hl = aHi * bLo, lh = aLo * bHi, ll = aLo * bLo;
+    const std::uint64_t mid = (ll >> 32) + static_cast<std::uint32_t>(hl) + static_cast<std::uint32_t>(lh);
+    lo = (mid << 32) | static_cast<std::uint32_t>(ll);
+    hi = hh + (hl >> 32) + (lh >> 32) + (mid >> 32);
+#endif
+}
+
+// The 128 bit product folded back with xor.
+inline std::uint64_t mum(const std::uint64_t a, const std::uint64_t b) noexcept {
+    std::uint64_t lo, hi;
+    multiply(a, b, lo, hi);
+    return lo ^ hi;
+}
+
+inline std::uint64_t read8(const unsigned char* ptr) noexcept {
+    std::uint64_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+inline std::uint64_t read4(const unsigned char* ptr) noexcept {
+    std::uint32_t value;
+    std::memcpy(&value, ptr, sizeof(value));
+    return value;
+}
+
+// 1 to 3 bytes: first, middle and last, which covers every byte of such short inputs.
+inline std::uint64_t read3(const unsigned char* ptr, const size_t len) noexcept {
+    return (static_cast<std::uint64_t>(ptr[0]) << 16) | (static_cast<std::uint64_t>(ptr[len >> 1]) << 8) | ptr[len - 1];
+}
+
+}
+
+// Integer mixer: every input bit reaches every output bit, so masking off the low bits of the
+// result (as `Hash` does) no longer clusters strided or aligned keys.
+inline std::uint64_t mix64(const std::uint64_t value) noexcept {
+    return detail::mum(value ^ detail::secret[0], detail::secret[1]);
+}
+
+// wyhash over `len` bytes. Not cryptographic: fast and well distributed, not resistant to inputs
+// chosen to collide.
+inline std::uint64_t hashBytes(const void* data, size_t len, std::uint64_t seed = 0) noexcept {
+    const auto* ptr = static_cast<const unsigned char*>(data);
+    const std::uint64_t* s = detail::secret;
+    seed ^= detail::mum(seed ^ s[0], s[1]);
+    std::uint64_t a, b;
+    if (len <= 16) {
+        if (len >= 4) {
+            const size_t step = (len >> 3) << 2;
+            a = (detail::read4(ptr) << 32) | detail::read4(ptr + step);
+            b = (detail::read4(ptr + len - 4) << 32) | detail::read4(ptr + len - 4 - step);
+        } else if (len > 0) {
+            a = detail::read3(ptr, len);
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        size_t left = len;
+        if (left > 48) {
+            // Three independent lanes keep the multipliers busy on long inputs.
+            std::uint64_t lane1 = seed, lane2 = seed;
+            do {
+                seed = detail::mum(detail::read8(ptr) ^ s[1], detail::read8(ptr + 8) ^ seed);
+                lane1 = detail::mum(detail::read8(ptr + 16) ^ s[2], detail::read8(ptr + 24) ^ lane1);
+                lane2 = detail::mum(detail::read8(ptr + 32) ^ s[3], detail::read8(ptr + 40) ^ lane2);
+                ptr += 48;
+                left -= 48;
+            } while (left > 48);
+            seed ^= lane1 ^ lane2;
+        }
+        while (left > 16) {
+            seed = detail::mum(detail::read8(ptr) ^ s[1], detail::read8(ptr + 8) ^ seed);
+            ptr += 16;
+            left -= 16;
+        }
+        a = detail::read8(ptr + left - 16);
+        b = detail::read8(ptr + left - 8);
+    }
+    a ^= s[1];
+    b ^= seed;
+    detail::multiply(a, b, a, b);
+    return detail::mum(a ^ s[0] ^ len, b ^ s[1]);
+}
+
+inline std::uint64_t hashBytes(const std::string_view view, const std::uint64_t seed = 0) noexcept {
+    return hashBytes(view.data(), view.size(), seed);
+}
+
+// A hash functor declares `is_avalanching` when all of its output bits are already well mixed;
+// `FlatHash` then uses the value as is instead of mixing it again.
+template<typename HashFn>
+constexpr bool isAvalanchingV = requires {
+    typename HashFn::is_avalanching;
+};
+
+// Default hash for the hash tables. Integers, enums and pointers go through `mix64`, string views
+// through `hashBytes`; any other type is hashed with its `std::hash` and then mixed.
+// `containers::String` is specialized in String.h.
+template<typename T>
+struct Hasher {
+    using is_avalanching = void;
+
+    size_t operator()(const T& value) const noexcept(noexcept(std::hash<T>{}(value))) {
+        if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) {
+            return static_cast<size_t>(mix64(static_cast<std::uint64_t>(value)));
+        } else if constexpr (std::is_pointer_v<T>) {
+            return static_cast<size_t>(mix64(reinterpret_cast<std::uintptr_t>(value)));
+        } else {
+            return static_cast<size_t>(mix64(static_cast<std::uint64_t>(std::hash<T>{}(value))));
+        }
+    }
+};
+
+template<>
+struct Hasher<std::string_view> {
+    using is_avalanching = void;
+
+    size_t operator()(const std::string_view view) const noexcept {
+        return static_cast<size_t>(hashBytes(view));
+    }
+};
+
+}
+
+#endif // HASHER_H
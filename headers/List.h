@@ -19,13 +19,17 @@ private:
     typename std::allocator_traits<Alloc>::template rebind_alloc<detail::lstNode<T>> alloc;
 
 public:
-    List() {
+    List() : List(Alloc()) {
+
+    }
+
+    explicit List(const Alloc& a) : alloc(a) {
         sentinel = static_cast<detail::lstNode<T>*>(operator new(sizeof(detail::lstNode<T>)));
         sentinel->next = sentinel;
         sentinel->last = sentinel;
     }
 
-    List(const List& other) : List() {
+    List(const List& other) : List(Alloc(std::allocator_traits<decltype(alloc)>::select_on_container_copy_construction(other.alloc))) {
         for (const auto& element : other) {
             pushBack(element);
         }
@@ -44,9 +48,10 @@ public:
     void swap(List& other) noexcept {
         std::swap(sentinel, other.sentinel);
         std::swap(len, other.len);
+        std::swap(alloc, other.alloc);
     }
 
-    List(List&& other) noexcept : List() {
+    List(List&& other) noexcept : List(Alloc(other.alloc)) {
         swap(other);
     }
 
@@ -56,6 +61,7 @@ public:
             operator delete(sentinel);
             sentinel = other.sentinel;
             len = other.len;
+            alloc = other.alloc;
             other.sentinel = nullptr;
             other.len = 0;
         }
@@ -73,11 +79,13 @@ public:
     }
 
     void clear() {
-        detail::lstNode<T>* curr = sentinel->next;
-        while (curr != sentinel) {
-            detail::lstNode<T>* nxt = curr->next;
-            detail::lstOps<T, Alloc>::destroy(alloc, curr);
-            curr = nxt;
+        if constexpr (!detail::isMonotonicAllocV<decltype(alloc)> || !std::is_trivially_destructible_v<T>) {
+            detail::lstNode<T>* curr = sentinel->next;
+            while (curr != sentinel) {
+                detail::lstNode<T>* nxt = curr->next;
+                detail::lstOps<T, Alloc>::destroy(alloc, curr);
+                curr = nxt;
+            }
         }
         sentinel->last = sentinel;
         sentinel->next = sentinel;
@@ -108,6 +116,26 @@ public:
         return detail::lstIterator<T>{ nxt };
     }
 
+    // Unlinks the node at `pos` without destroying it; the caller owns it until it is `adopt`ed.
+    detail::lstNode<T>* release(detail::lstIterator<T> pos) noexcept {
+        if (pos.curr == sentinel) {
+            return nullptr;
+        }
+        detail::lstNode<T>* node = pos.curr;
+        detail::lstOps<T, Alloc>::unlink(node);
+        len--;
+        return node;
+    }
+
+    // Links a node released by a list whose allocator compares equal to this one before `pos`.
+    detail::lstIterator<T> adopt(detail::lstIterator<T> pos, detail::lstNode<T>* node) noexcept {
+        detail::lstNode<T>* curr = pos.curr;
+        detail::lstOps<T, Alloc>::link(curr->last, node);
+        detail::lstOps<T, Alloc>::link(node, curr);
+        len++;
+        return detail::lstIterator<T>(node);
+    }
+
     detail::lstIterator<T> find(const T& value) {
         for (auto it = begin(); it != end(); ++it) {
             if (*it == value) {
@@ -277,6 +305,11 @@ public:
     }
 };
 
+template<typename T, typename Alloc>
+struct detail::isTriviallyRelocatable<List<T, Alloc>> : std::bool_constant<std::is_empty_v<typename std::allocator_traits<Alloc>::template rebind_alloc<lstNode<T>>>> {
+
+};
+
 }
 
 #endif // LIST_H
@@ -11,14 +11,24 @@
 
 namespace mySTL::containers {
 
-template<typename T, typename Alloc = std::allocator<T>>
+// `Inline` > 0 keeps up to that many neighbours per site inside the site (`SmallArray`). Sites and
+// their neighbour lists allocate through `Alloc`, rebound.
+template<typename T, typename Alloc = std::allocator<T>, size_t Inline = 0>
 class Network {
 public:
+    struct Site;
+
+    using NeighborAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Site*>;
+
+    using NeighborArray = std::conditional_t<Inline == 0,
+        Array<Site*, detail::lazyGrowth, detail::conStorage<Site*, NeighborAlloc, detail::lazyGrowth>>,
+        Array<Site*, detail::eagerGrowth, detail::smallStorage<Site*, Inline == 0 ? 1 : Inline, NeighborAlloc>>>;
+
     struct Site {
     private:
         size_t id;
         T value;
-        Array<Site*> neighbors;
+        NeighborArray neighbors;
         Network* owner;
 
         friend class Network;
@@ -28,11 +38,15 @@ public:
 
         }
 
+        Site(Network* owner, const size_t id, const T& value, const NeighborAlloc& alloc) : id(id), value(value), neighbors(alloc), owner(owner) {
+
+        }
+
         const T& getValue() const noexcept{
             return value;
         }
 
-        const Array<Site*>& getNeighbors() const noexcept {
+        const NeighborArray& getNeighbors() const noexcept {
             return neighbors;
         }
     };
@@ -68,8 +82,8 @@ private:
         }
     }
 
-    template<typename U, typename A>
-    friend std::ostream& operator<<(std::ostream& os, const Network<U, A>& network);
+    template<typename U, typename A, size_t N>
+    friend std::ostream& operator<<(std::ostream& os, const Network<U, A, N>& network);
 
 public:
     Network() = default;
@@ -118,7 +132,7 @@ public:
     Site* create(const T& value) {
         Site* site = siteTraits::allocate(alloc, 1);
         try {
-            siteTraits::construct(alloc, site, this, nId, value);
+            siteTraits::construct(alloc, site, this, nId, value, NeighborAlloc(alloc));
             sites.pushBack(site);
             ++nId;
             return site;
@@ -135,25 +149,16 @@ public:
             if (sites[i] == site) {
                 continue;
             }
-            size_t index = -1;
-            for (size_t j = 0; j < sites[i]->neighbors.getSize(); ++j) {
-                if (sites[i]->neighbors[j] == site) {
-                    index = j;
-                    break;
-                }
-            }
+            const size_t index = sites[i]->neighbors.find(site);
             if (index < sites[i]->neighbors.getSize()) {
                 std::swap(sites[i]->neighbors[index], sites[i]->neighbors.back());
                 sites[i]->neighbors.popBack();
             }
         }
-        for (size_t i = 0; i < sites.getSize(); i++) {
-            if (sites[i] == site) {
-                std::swap(sites[i], sites.back());
-                sites.popBack();
-                destroySite(site);
-                break;
-            }
+        if (const size_t index = sites.find(site); index < sites.getSize()) {
+            std::swap(sites[index], sites.back());
+            sites.popBack();
+            destroySite(site);
         }
     }
 
@@ -164,8 +169,8 @@ public:
     }
 };
 
-template<typename T, typename Alloc>
-std::ostream& operator<<(std::ostream& os, const Network<T, Alloc>& net) {
+template<typename T, typename Alloc, size_t Inline>
+std::ostream& operator<<(std::ostream& os, const Network<T, Alloc, Inline>& net) {
     net.dump(os);
     return os;
 }
@@ -0,0 +1,364 @@
+//
+// Created by Ivor_Aif on 2026/10/17.
+//
+
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+
+#include "Array.h"
+#include "Scheduler.h"
+
+namespace mySTL::parallel {
+
+namespace detail {
+
+// Below this many elements per chunk the work is not worth a hand-off to another thread.
+constexpr size_t minGrain = 1 << 12;
+
+inline std::atomic<size_t>& concurrencyLimit() {
+    static std::atomic<size_t> limit(Scheduler::shared().getSize() + 1);
+    return limit;
+}
+
+template<typename C>
+constexpr bool isRangeV = !std::is_pointer_v<std::remove_reference_t<C>> && requires(C& c) {
+    c.begin();
+    c.end();
+};
+
+// Runs `fn(i)` for every i in [0, count): task 0 on the calling thread, the rest on the shared
+// scheduler. The caller helps run queued work while it waits, so nested calls are safe.
+template<typename Fn>
+void runTasks(const size_t count, Fn&& fn) {
+    if (count == 0) {
+        return;
+    }
+    if (count == 1) {
+        fn(0);
+        return;
+    }
+    Scheduler& scheduler = Scheduler::shared();
+    std::atomic<size_t> remaining(count - 1);
+    std::mutex errorLock;
+    std::exception_ptr error;
+    auto record = [&] {
+        std::lock_guard guard(errorLock);
+        if (!error) {
+            error = std::current_exception();
+        }
+    };
+    for (size_t i = 1; i < count; ++i) {
+        scheduler.submit([&fn, &remaining, &record, i] {
+            try {
+                fn(i);
+            } catch (...) {
+                record();
+            }
+            remaining.fetch_sub(1, std::memory_order_release);
+        });
+    }
+    try {
+        fn(0);
+    } catch (...) {
+        record();
+    }
+    scheduler.waitFor(remaining);
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+inline size_t chunksFor(const size_t nn) noexcept {
+    const size_t limit = concurrencyLimit().load(std::memory_order_relaxed);
+    const size_t byGrain = nn / minGrain ? nn / minGrain : 1;
+    return std::min(limit ? limit : 1, byGrain);
+}
+
+inline size_t chunkBound(const size_t nn, const size_t chunks, const size_t idx) noexcept {
+    return nn / chunks * idx + std::min(idx, nn % chunks);
+}
+
+// Number of elements taken from `a` among the first `rank` of the stable merge of `a` and `b`.
+template<typename It, typename Compare>
+size_t coRank(const size_t rank, It a, const size_t aLen, It b, const size_t bLen, Compare& comp) {
+    size_t lo = rank > bLen ? rank - bLen : 0, hi = std::min(rank, aLen);
+    while (lo < hi) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (comp(b[rank - mid - 1], a[mid])) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+// One round of `sort`: merges the sorted runs [lo, lo + width) and [lo + width, lo + 2 * width) of
+// `chunks` runs from `src` into the same positions of `dst`, moving an unpaired last run as is. The
+// split points are all found before any task starts, since merging moves elements out of `src`.
+template<typename Src, typename Dst, typename Compare>
+void mergeRound(Src src, Dst dst, const size_t nn, const size_t chunks, const size_t width, Compare& comp) {
+    const size_t pairs = (chunks + 2 * width - 1) / (2 * width);
+    const size_t perPair = std::max<size_t>(chunks / pairs, 1);
+    struct Task {
+        size_t begin, mid, end, from, aFrom;
+    };
+    containers::Array<Task, containers::detail::lazyGrowth> tasks;
+    tasks.reserve(pairs * perPair);
+    for (size_t lo = 0; lo < chunks; lo += 2 * width) {
+        const size_t begin = chunkBound(nn, chunks, lo);
+        const size_t mid = chunkBound(nn, chunks, std::min(lo + width, chunks));
+        const size_t end = chunkBound(nn, chunks, std::min(lo + 2 * width, chunks));
+        for (size_t part = 0; part < perPair; ++part) {
+            const size_t from = (end - begin) * part / perPair;
+            tasks.pushBack({begin, mid, end, from, coRank(from, src + begin, mid - begin, src + mid, end - mid, comp)});
+        }
+    }
+    runTasks(pairs * perPair, [&](const size_t t) {
+        const Task& task = tasks[t];
+        const bool last = t % perPair == perPair - 1;
+        const size_t to = last ? task.end - task.begin : tasks[t + 1].from;
+        const size_t aTo = last ? task.mid - task.begin : tasks[t + 1].aFrom;
+        std::merge(std::make_move_iterator(src + task.begin + task.aFrom), std::make_move_iterator(src + task.begin + aTo),
+                   std::make_move_iterator(src + task.mid + (task.from - task.aFrom)), std::make_move_iterator(src + task.mid + (to - aTo)),
+                   dst + task.begin + task.from, comp);
+    });
+}
+
+}
+
+// Upper bound on the number of threads (the caller included) an algorithm splits its input over.
+inline void setConcurrency(const size_t count) noexcept {
+    detail::concurrencyLimit().store(count ? count : 1, std::memory_order_relaxed);
+}
+
+[[nodiscard]] inline size_t getConcurrency() noexcept {
+    return detail::concurrencyLimit().load(std::memory_order_relaxed);
+}
+
+template<typename RandomIt, typename Fn>
+void forEach(RandomIt first, RandomIt last, Fn fn) {
+    const auto nn = static_cast<size_t>(last - first);
+    const size_t chunks = detail::chunksFor(nn);
+    detail::runTasks(chunks, [&](const size_t c) {
+        const RandomIt end = first + detail::chunkBound(nn, chunks, c + 1);
+        for (RandomIt it = first + detail::chunkBound(nn, chunks, c); it != end; ++it) {
+            fn(*it);
+        }
+    });
+}
+
+template<typename RandomIt, typename OutputIt, typename Fn>
+OutputIt transform(RandomIt first, RandomIt last, OutputIt out, Fn fn) {
+    const auto nn = static_cast<size_t>(last - first);
+    const size_t chunks = detail::chunksFor(nn);
+    detail::runTasks(chunks, [&](const size_t c) {
+        const size_t end = detail::chunkBound(nn, chunks, c + 1);
+        for (size_t i = detail::chunkBound(nn, chunks, c); i < end; ++i) {
+            out[i] = fn(first[i]);
+        }
+    });
+    return out + nn;
+}
+
+// `op` must be associative; chunks are combined left to right, so it need not be commutative.
+template<typename RandomIt, typename T, typename Op = std::plus<>>
+T reduce(RandomIt first, RandomIt last, T init, Op op = Op()) {
+    const auto nn = static_cast<size_t>(last - first);
+    if (nn == 0) {
+        return init;
+    }
+    const size_t chunks = detail::chunksFor(nn);
+    containers::Array<T, containers::detail::lazyGrowth> partial(chunks, init);
+    detail::runTasks(chunks, [&](const size_t c) {
+        const size_t begin = detail::chunkBound(nn, chunks, c), end = detail::chunkBound(nn, chunks, c + 1);
+        T acc = first[begin];
+        for (size_t i = begin + 1; i < end; ++i) {
+            acc = op(std::move(acc), first[i]);
+        }
+        partial[c] = std::move(acc);
+    });
+    for (size_t c = 0; c < chunks; ++c) {
+        init = op(std::move(init), std::move(partial[c]));
+    }
+    return init;
+}
+
+// Sorts each chunk, then merges neighbouring runs pairwise in rounds. Every round is split evenly
+// over all chunks' worth of tasks, whatever the number of pairs left, by cutting each merge at
+// co-ranks, so the last round over all n elements runs as wide as the first. Rounds alternate
+// between the input and a buffer of n elements.
+template<typename RandomIt, typename Compare = std::less<>>
+void sort(RandomIt first, RandomIt last, Compare comp = Compare()) {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    const auto nn = static_cast<size_t>(last - first);
+    const size_t chunks = detail::chunksFor(nn);
+    detail::runTasks(chunks, [&](const size_t c) {
+        std::sort(first + detail::chunkBound(nn, chunks, c), first + detail::chunkBound(nn, chunks, c + 1), comp);
+    });
+    if (chunks <= 1) {
+        return;
+    }
+    // Elements that need construction are moved into the buffer up front, so the runs start there.
+    containers::Array<T, containers::detail::lazyGrowth> buffer;
+    bool inBuffer = false;
+    if constexpr (std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>) {
+        buffer.resizeUninitialized(nn);
+    } else {
+        buffer.reserve(nn);
+        buffer.append(std::make_move_iterator(first), std::make_move_iterator(last));
+        inBuffer = true;
+    }
+    for (size_t width = 1; width < chunks; width <<= 1) {
+        if (inBuffer) {
+            detail::mergeRound(buffer.getData(), first, nn, chunks, width, comp);
+        } else {
+            detail::mergeRound(first, buffer.getData(), nn, chunks, width, comp);
+        }
+        inBuffer = !inBuffer;
+    }
+    if (inBuffer) {
+        detail::runTasks(chunks, [&](const size_t c) {
+            T* data = buffer.getData();
+            std::move(data + detail::chunkBound(nn, chunks, c), data + detail::chunkBound(nn, chunks, c + 1), first + detail::chunkBound(nn, chunks, c));
+        });
+    }
+}
+
+template<typename RandomIt, typename OutputIt, typename Op = std::plus<>>
+OutputIt inclusiveScan(RandomIt first, RandomIt last, OutputIt out, Op op = Op()) {
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    const auto nn = static_cast<size_t>(last - first);
+    if (nn == 0) {
+        return out;
+    }
+    const size_t chunks = detail::chunksFor(nn);
+    containers::Array<T, containers::detail::lazyGrowth> carry(chunks, first[0]);
+    detail::runTasks(chunks, [&](const size_t c) {
+        const size_t begin = detail::chunkBound(nn, chunks, c), end = detail::chunkBound(nn, chunks, c + 1);
+        T acc = first[begin];
+        for (size_t i = begin + 1; i < end; ++i) {
+            acc = op(std::move(acc), first[i]);
+        }
+        carry[c] = std::move(acc);
+    });
+    for (size_t c = 1; c < chunks; ++c) {
+        carry[c] = op(carry[c - 1], std::move(carry[c]));
+    }
+    detail::runTasks(chunks, [&](const size_t c) {
+        const size_t begin = detail::chunkBound(nn, chunks, c), end = detail::chunkBound(nn, chunks, c + 1);
+        T acc = c ? op(carry[c - 1], first[begin]) : T(first[begin]);
+        out[begin] = acc;
+        for (size_t i = begin + 1; i < end; ++i) {
+            acc = op(std::move(acc), first[i]);
+            out[i] = acc;
+        }
+    });
+    return out + nn;
+}
+
+// Unstable. Each chunk is partitioned in place, then the misplaced elements on both sides of the
+// final split point are swapped pairwise in parallel; no buffer is allocated.
+template<typename RandomIt, typename Pred>
+RandomIt partition(RandomIt first, RandomIt last, Pred pred) {
+    const auto nn = static_cast<size_t>(last - first);
+    const size_t chunks = detail::chunksFor(nn);
+    if (chunks <= 1) {
+        return std::partition(first, last, pred);
+    }
+    containers::Array<size_t, containers::detail::lazyGrowth> trues(chunks, 0);
+    detail::runTasks(chunks, [&](const size_t c) {
+        const RandomIt begin = first + detail::chunkBound(nn, chunks, c);
+        trues[c] = static_cast<size_t>(std::partition(begin, first + detail::chunkBound(nn, chunks, c + 1), pred) - begin);
+    });
+    const size_t split = trues.sum();
+    // Runs of false elements left of `split` and of true elements right of it, as [start, end).
+    containers::Array<containers::detail::KeyValue<size_t, size_t>, containers::detail::lazyGrowth> wrongFront, wrongBack;
+    size_t misplaced = 0;
+    for (size_t c = 0; c < chunks; ++c) {
+        const size_t begin = detail::chunkBound(nn, chunks, c), mid = begin + trues[c], end = detail::chunkBound(nn, chunks, c + 1);
+        if (mid < split && mid < end) {
+            wrongFront.pushBack({ mid, std::min(end, split) });
+            misplaced += std::min(end, split) - mid;
+        }
+        if (mid > split && begin < mid) {
+            wrongBack.pushBack({ std::max(begin, split), mid });
+        }
+    }
+    if (misplaced == 0) {
+        return first + split;
+    }
+    const size_t tasks = std::min(chunks, misplaced / detail::minGrain + 1);
+    detail::runTasks(tasks, [&](const size_t t) {
+        size_t rank = detail::chunkBound(misplaced, tasks, t), todo = detail::chunkBound(misplaced, tasks, t + 1) - rank;
+        size_t fi = 0, bi = 0, fpos = 0, bpos = 0;
+        for (size_t skip = rank; ; ++fi) {
+            if (const size_t len = wrongFront[fi].second - wrongFront[fi].first; skip < len) {
+                fpos = wrongFront[fi].first + skip;
+                break;
+            } else {
+                skip -= len;
+            }
+        }
+        for (size_t skip = rank; ; ++bi) {
+            if (const size_t len = wrongBack[bi].second - wrongBack[bi].first; skip < len) {
+                bpos = wrongBack[bi].first + skip;
+                break;
+            } else {
+                skip -= len;
+            }
+        }
+        while (todo--) {
+            std::iter_swap(first + fpos, first + bpos);
+            if (++fpos == wrongFront[fi].second && todo) {
+                fpos = wrongFront[++fi].first;
+            }
+            if (++bpos == wrongBack[bi].second && todo) {
+                bpos = wrongBack[++bi].first;
+            }
+        }
+    });
+    return first + split;
+}
+
+template<typename Range, typename Fn, std::enable_if_t<detail::isRangeV<Range>>* = nullptr>
+void forEach(Range& range, Fn fn) {
+    parallel::forEach(range.begin(), range.end(), std::move(fn));
+}
+
+template<typename Range, typename Out, typename Fn, std::enable_if_t<detail::isRangeV<Range> && detail::isRangeV<Out>>* = nullptr>
+void transform(const Range& range, Out& out, Fn fn) {
+    parallel::transform(range.begin(), range.end(), out.begin(), std::move(fn));
+}
+
+template<typename Range, typename T, typename Op = std::plus<>, std::enable_if_t<detail::isRangeV<Range>>* = nullptr>
+T reduce(const Range& range, T init, Op op = Op()) {
+    return parallel::reduce(range.begin(), range.end(), std::move(init), std::move(op));
+}
+
+template<typename Range, typename Compare = std::less<>, std::enable_if_t<detail::isRangeV<Range>>* = nullptr>
+void sort(Range& range, Compare comp = Compare()) {
+    parallel::sort(range.begin(), range.end(), std::move(comp));
+}
+
+template<typename Range, typename Out, typename Op = std::plus<>, std::enable_if_t<detail::isRangeV<Range> && detail::isRangeV<Out>>* = nullptr>
+void inclusiveScan(const Range& range, Out& out, Op op = Op()) {
+    parallel::inclusiveScan(range.begin(), range.end(), out.begin(), std::move(op));
+}
+
+template<typename Range, typename Pred, std::enable_if_t<detail::isRangeV<Range>>* = nullptr>
+auto partition(Range& range, Pred pred) {
+    return parallel::partition(range.begin(), range.end(), std::move(pred));
+}
+
+}
+
+#endif // PARALLEL_H
@@ -0,0 +1,778 @@
+//
+// Created by Ivor_Aif on 2026/10/18.
+//
+
+#ifndef PERSISTENTHASH_H
+#define PERSISTENTHASH_H
+
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "Containers.h"
+#include "Hasher.h"
+
+namespace mySTL::containers {
+
+// Hash array mapped trie with structural sharing. Each level consumes 5 bits of the (mixed) 64-bit
+// hash; a branch keeps a 32-bit bitmap of the slots in use and a packed array of children. Keys
+// whose full hashes collide share a collision node.
+//
+// One writer mutates the map; `snapshot()` hands out an immutable view in O(1) that any thread may
+// read while the writer carries on. Nodes are reference counted: a snapshot pins the root it was
+// taken from, and whatever a mutation replaces is freed by whoever drops its last reference.
+// A mutation copies the path from the root to the changed entry, except for the leading part of
+// that path no snapshot can reach, which is updated in place.
+//
+// Every mutating member must be called from one thread at a time. `find`, `contains`, `get` and
+// `forEach` on the map itself are for that thread too; other threads read through snapshots.
+// `Alloc` may be called from any thread that drops a snapshot and must be thread-safe
+// (std::allocator and `memory::PoolAllocator` are).
+template<typename Key, typename T, typename HashFn = hash::Hasher<Key>, typename KeyEqual = std::equal_to<Key>, typename Alloc = std::allocator<detail::KeyValue<const Key, T>>>
+class PersistentHash {
+private:
+    using VT = detail::KeyValue<const Key, T>;
+
+    static constexpr unsigned levelBits = 5;
+    static constexpr std::uint64_t levelMask = (1u << levelBits) - 1;
+
+    enum class Kind : std::uint8_t {
+        branch,
+        leaf,
+        collision
+    };
+
+    struct Node {
+        std::atomic<std::uint32_t> refs{1};
+        std::uint32_t units = 0;
+        Kind kind;
+
+        explicit Node(const Kind k) : kind(k) {
+
+        }
+    };
+
+    struct Branch : Node {
+        std::uint32_t bitmap = 0;
+
+        Branch() : Node(Kind::branch) {
+
+        }
+    };
+
+    struct Leaf : Node {
+        std::uint64_t hash;
+        VT value;
+
+        template<typename... Args>
+        explicit Leaf(const std::uint64_t h, Args&&... args) : Node(Kind::leaf), hash(h), value(std::forward<Args>(args)...) {
+
+        }
+    };
+
+    struct Collision : Node {
+        std::uint64_t hash;
+        std::uint32_t count = 0;
+
+        explicit Collision(const std::uint64_t h) : Node(Kind::collision), hash(h) {
+
+        }
+    };
+
+    // Nodes are carved from an allocator of max-aligned units, so branches and collision nodes can
+    // keep their children or entries right behind the header.
+    struct alignas(alignof(std::max_align_t)) Unit {
+        unsigned char bytes[alignof(std::max_align_t)];
+    };
+
+    static_assert(alignof(VT) <= alignof(Unit), "PersistentHash does not support over-aligned entries");
+
+    using UnitAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Unit>;
+    using unitTraits = std::allocator_traits<UnitAlloc>;
+
+    template<typename Head, typename Elem>
+    static constexpr size_t trailingOffset = (sizeof(Head) + alignof(Elem) - 1) / alignof(Elem) * alignof(Elem);
+
+    template<typename Head, typename Elem>
+    static Elem* trailing(Head* head) noexcept {
+        return reinterpret_cast<Elem*>(reinterpret_cast<unsigned char*>(head) + trailingOffset<Head, Elem>);
+    }
+
+    template<typename Head, typename Elem>
+    static const Elem* trailing(const Head* head) noexcept {
+        return reinterpret_cast<const Elem*>(reinterpret_cast<const unsigned char*>(head) + trailingOffset<Head, Elem>);
+    }
+
+    static Node** children(Branch* branch) noexcept {
+        return trailing<Branch, Node*>(branch);
+    }
+
+    static Node* const* children(const Branch* branch) noexcept {
+        return trailing<Branch, Node*>(branch);
+    }
+
+    static VT* entries(Collision* coll) noexcept {
+        return trailing<Collision, VT>(coll);
+    }
+
+    static const VT* entries(const Collision* coll) noexcept {
+        return trailing<Collision, VT>(coll);
+    }
+
+    // Lookups and node management need only the functors and the allocator, so the writer and its
+    // snapshots share this part.
+    struct Core {
+        [[no_unique_address]] HashFn hashFn;
+        [[no_unique_address]] KeyEqual keyEq;
+        [[no_unique_address]] UnitAlloc alloc;
+
+        Core(const HashFn& hf, const KeyEqual& eq, const Alloc& a) : hashFn(hf), keyEq(eq), alloc(a) {
+
+        }
+
+        // A HashFn that is not known to avalanche is mixed, since every level reads its own bits.
+        std::uint64_t hashOf(const Key& key) const {
+            if constexpr (hash::isAvalanchingV<HashFn>) {
+                return static_cast<std::uint64_t>(hashFn(key));
+            } else {
+                return hash::mix64(static_cast<std::uint64_t>(hashFn(key)));
+            }
+        }
+
+        template<typename N, typename... Args>
+        N* make(const size_t bytes, Args&&... args) {
+            const size_t units = (bytes + sizeof(Unit) - 1) / sizeof(Unit);
+            Unit* raw = unitTraits::allocate(alloc, units);
+            N* node;
+            try {
+                node = ::new (static_cast<void*>(raw)) N(std::forward<Args>(args)...);
+            } catch (...) {
+                unitTraits::deallocate(alloc, raw, units);
+                throw;
+            }
+            node->units = static_cast<std::uint32_t>(units);
+            return node;
+        }
+
+        // Frees a node whose children or entries were never filled in.
+        void discard(Node* node) noexcept {
+            const size_t units = node->units;
+            node->~Node();
+            unitTraits::deallocate(alloc, reinterpret_cast<Unit*>(node), units);
+        }
+
+        static void retain(Node* node) noexcept {
+            node->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Drops one reference and frees the subtree it was the last one to.
+        void release(Node* node) noexcept {
+            if (!node || node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                return;
+            }
+            const size_t units = node->units;
+            switch (node->kind) {
+                case Kind::branch: {
+                    auto* branch = static_cast<Branch*>(node);
+                    Node** kids = children(branch);
+                    const int count = std::popcount(branch->bitmap);
+                    for (int i = 0; i < count; ++i) {
+                        release(kids[i]);
+                    }
+                    branch->~Branch();
+                    break;
+                }
+                case Kind::leaf:
+                    static_cast<Leaf*>(node)->~Leaf();
+                    break;
+                case Kind::collision: {
+                    auto* coll = static_cast<Collision*>(node);
+                    std::destroy_n(entries(coll), coll->count);
+                    coll->~Collision();
+                    break;
+                }
+            }
+            unitTraits::deallocate(alloc, reinterpret_cast<Unit*>(node), units);
+        }
+
+        const VT* lookup(const Node* node, const std::uint64_t hash, const Key& key) const {
+            for (unsigned shift = 0; node; shift += levelBits) {
+                switch (node->kind) {
+                    case Kind::branch: {
+                        auto* branch = static_cast<const Branch*>(node);
+                        const std::uint32_t bit = 1u << ((hash >> shift) & levelMask);
+                        if (!(branch->bitmap & bit)) {
+                            return nullptr;
+                        }
+                        node = children(branch)[std::popcount(branch->bitmap & (bit - 1))];
+                        break;
+                    }
+                    case Kind::leaf: {
+                        auto* leaf = static_cast<const Leaf*>(node);
+                        return leaf->hash == hash && keyEq(leaf->value.first, key) ? &leaf->value : nullptr;
+                    }
+                    case Kind::collision: {
+                        auto* coll = static_cast<const Collision*>(node);
+                        if (coll->hash != hash) {
+                            return nullptr;
+                        }
+                        for (std::uint32_t i = 0; i < coll->count; ++i) {
+                            if (keyEq(entries(coll)[i].first, key)) {
+                                return &entries(coll)[i];
+                            }
+                        }
+                        return nullptr;
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+        template<typename Fn>
+        static void visit(const Node* node, Fn& fn) {
+            if (!node) {
+                return;
+            }
+            switch (node->kind) {
+                case Kind::branch: {
+                    auto* branch = static_cast<const Branch*>(node);
+                    const int count = std::popcount(branch->bitmap);
+                    for (int i = 0; i < count; ++i) {
+                        visit(children(branch)[i], fn);
+                    }
+                    break;
+                }
+                case Kind::leaf: {
+                    auto* leaf = static_cast<const Leaf*>(node);
+                    fn(leaf->value.first, leaf->value.second);
+                    break;
+                }
+                case Kind::collision: {
+                    auto* coll = static_cast<const Collision*>(node);
+                    for (std::uint32_t i = 0; i < coll->count; ++i) {
+                        fn(entries(coll)[i].first, entries(coll)[i].second);
+                    }
+                    break;
+                }
+            }
+        }
+    };
+
+public:
+    // Immutable view of the map as it was when the snapshot was taken. Copying a snapshot is O(1);
+    // any number of threads may read one snapshot at once.
+    class Snapshot {
+        friend class PersistentHash;
+
+    private:
+        Core core;
+        Node* root;
+        size_t size;
+
+        Snapshot(const Core& c, Node* r, const size_t n) : core(c), root(r), size(n) {
+
+        }
+
+    public:
+        Snapshot(const Snapshot& other) : core(other.core), root(other.root), size(other.size) {
+            if (root) {
+                Core::retain(root);
+            }
+        }
+
+        Snapshot(Snapshot&& other) noexcept : core(other.core), root(std::exchange(other.root, nullptr)), size(std::exchange(other.size, 0)) {
+
+        }
+
+        Snapshot& operator=(Snapshot other) noexcept {
+            std::swap(core, other.core);
+            std::swap(root, other.root);
+            std::swap(size, other.size);
+            return *this;
+        }
+
+        ~Snapshot() {
+            core.release(root);
+        }
+
+        [[nodiscard]] size_t getSize() const noexcept {
+            return size;
+        }
+
+        [[nodiscard]] bool isEmpty() const noexcept {
+            return size == 0;
+        }
+
+        // Pointer to the value under `key`, or nullptr; valid as long as this snapshot lives.
+        const T* find(const Key& key) const {
+            const VT* entry = core.lookup(root, core.hashOf(key), key);
+            return entry ? &entry->second : nullptr;
+        }
+
+        bool contains(const Key& key) const {
+            return find(key) != nullptr;
+        }
+
+        const T& get(const Key& key) const {
+            const T* value = find(key);
+            if (!value) {
+                throw std::out_of_range("PersistentHash::Snapshot::get");
+            }
+            return *value;
+        }
+
+        // Calls `fn(key, value)` for every entry, in hash order.
+        template<typename Fn>
+        void forEach(Fn&& fn) const {
+            Core::visit(root, fn);
+        }
+    };
+
+private:
+    Core core;
+    Node* root = nullptr;
+    size_t size = 0;
+    // Guards `root` against a concurrent `snapshot()`: taking a snapshot reads the root and
+    // retains it under this lock, and the writer holds it while it may change nodes in place.
+    mutable std::atomic<bool> locked{false};
+
+    void lock() const noexcept {
+        while (locked.exchange(true, std::memory_order_acquire)) {
+            while (locked.load(std::memory_order_relaxed)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void unlock() const noexcept {
+        locked.store(false, std::memory_order_release);
+    }
+
+    static std::uint32_t slotBit(const std::uint64_t hash, const unsigned shift) noexcept {
+        return 1u << ((hash >> shift) & levelMask);
+    }
+
+    static bool unshared(const Node* node) noexcept {
+        return node->refs.load(std::memory_order_acquire) == 1;
+    }
+
+    Branch* makeBranch(const int count) {
+        return core.template make<Branch>(trailingOffset<Branch, Node*> + static_cast<size_t>(count) * sizeof(Node*));
+    }
+
+    template<typename... Args>
+    Leaf* makeLeaf(const std::uint64_t hash, Args&&... args) {
+        return core.template make<Leaf>(sizeof(Leaf), hash, std::forward<Args>(args)...);
+    }
+
+    // Copy of `branch` with `count` slots; the children it keeps are retained.
+    Branch* copyBranch(Branch* branch) {
+        const int count = std::popcount(branch->bitmap);
+        Branch* copy = makeBranch(count);
+        copy->bitmap = branch->bitmap;
+        for (int i = 0; i < count; ++i) {
+            Core::retain(children(copy)[i] = children(branch)[i]);
+        }
+        return copy;
+    }
+
+    // `branch` with `child` added in the slot for `bit`. An unshared branch hands its references
+    // over and is left empty, so releasing it afterwards frees only the shell.
+    Branch* withChild(Branch* branch, const bool owned, const std::uint32_t bit, Node* child) {
+        const int count = std::popcount(branch->bitmap);
+        const int pos = std::popcount(branch->bitmap & (bit - 1));
+        Branch* grown = makeBranch(count + 1);
+        grown->bitmap = branch->bitmap | bit;
+        Node** from = children(branch), ** to = children(grown);
+        for (int i = 0, j = 0; i <= count; ++i) {
+            to[i] = i == pos ? child : from[j++];
+        }
+        if (owned) {
+            branch->bitmap = 0;
+        } else {
+            for (int i = 0; i <= count; ++i) {
+                if (i != pos) {
+                    Core::retain(to[i]);
+                }
+            }
+        }
+        return grown;
+    }
+
+    // `branch` without the slot for `bit`, with the same handover as `withChild`.
+    Branch* withoutChild(Branch* branch, const bool owned, const std::uint32_t bit) {
+        const int count = std::popcount(branch->bitmap);
+        const int pos = std::popcount(branch->bitmap & (bit - 1));
+        Branch* shrunk = makeBranch(count - 1);
+        shrunk->bitmap = branch->bitmap & ~bit;
+        Node** from = children(branch), ** to = children(shrunk);
+        for (int i = 0, j = 0; i < count; ++i) {
+            if (i != pos) {
+                to[j++] = from[i];
+            }
+        }
+        if (owned) {
+            // The dropped child keeps its reference so the caller's release of `branch` frees it.
+            from[0] = from[pos];
+            branch->bitmap = 1;
+        } else {
+            for (int i = 0; i < count - 1; ++i) {
+                Core::retain(to[i]);
+            }
+        }
+        return shrunk;
+    }
+
+    // Smallest subtree holding both `a` and `b` (hashes differ) from level `shift` down; takes
+    // over one reference to each.
+    Node* join(const unsigned shift, Node* a, const std::uint64_t ha, Node* b, const std::uint64_t hb) {
+        const std::uint32_t bitA = slotBit(ha, shift), bitB = slotBit(hb, shift);
+        Branch* branch;
+        try {
+            branch = makeBranch(bitA == bitB ? 1 : 2);
+        } catch (...) {
+            core.release(a);
+            core.release(b);
+            throw;
+        }
+        if (bitA == bitB) {
+            try {
+                children(branch)[0] = join(shift + levelBits, a, ha, b, hb);
+            } catch (...) {
+                core.discard(branch);
+                throw;
+            }
+            branch->bitmap = bitA;
+            return branch;
+        }
+        branch->bitmap = bitA | bitB;
+        children(branch)[0] = bitA < bitB ? a : b;
+        children(branch)[1] = bitA < bitB ? b : a;
+        return branch;
+    }
+
+    static std::uint64_t hashOfNode(const Node* node) noexcept {
+        return node->kind == Kind::leaf ? static_cast<const Leaf*>(node)->hash : static_cast<const Collision*>(node)->hash;
+    }
+
+    // Collision node holding `coll`'s entries (minus `skip`, if below count) plus `extra`.
+    template<typename... Extra>
+    Collision* rebuildCollision(const std::uint64_t hash, const VT* from, const std::uint32_t count, const std::uint32_t skip, Extra&&... extra) {
+        const std::uint32_t kept = count - (skip < count ? 1 : 0);
+        const std::uint32_t total = kept + static_cast<std::uint32_t>(sizeof...(Extra) ? 1 : 0);
+        Collision* coll = core.template make<Collision>(trailingOffset<Collision, VT> + total * sizeof(VT), hash);
+        VT* to = entries(coll);
+        try {
+            for (std::uint32_t i = 0; i < count; ++i) {
+                if (i != skip) {
+                    ::new (static_cast<void*>(to + coll->count)) VT(from[i]);
+                    ++coll->count;
+                }
+            }
+            if constexpr (sizeof...(Extra) > 0) {
+                ::new (static_cast<void*>(to + coll->count)) VT(std::forward<Extra>(extra)...);
+                ++coll->count;
+            }
+        } catch (...) {
+            core.release(coll);
+            throw;
+        }
+        return coll;
+    }
+
+    // Returns the subtree with `key` set. The result is `node` itself when nothing had to be copied
+    // (or nothing changed), otherwise a new node the caller stores in place of `node`, releasing
+    // `node` if it owned the slot in place.
+    template<typename V>
+    Node* assoc(Node* node, bool owned, const unsigned shift, const std::uint64_t hash, const Key& key, V&& value, const bool assign, bool& inserted) {
+        owned = owned && unshared(node);
+        switch (node->kind) {
+            case Kind::branch: {
+                auto* branch = static_cast<Branch*>(node);
+                const std::uint32_t bit = slotBit(hash, shift);
+                if (!(branch->bitmap & bit)) {
+                    Leaf* leaf = makeLeaf(hash, key, std::forward<V>(value));
+                    inserted = true;
+                    try {
+                        return withChild(branch, owned, bit, leaf);
+                    } catch (...) {
+                        core.release(leaf);
+                        throw;
+                    }
+                }
+                const int pos = std::popcount(branch->bitmap & (bit - 1));
+                Node* child = children(branch)[pos];
+                Node* result = assoc(child, owned, shift + levelBits, hash, key, std::forward<V>(value), assign, inserted);
+                if (result == child) {
+                    return node;
+                }
+                if (owned) {
+                    children(branch)[pos] = result;
+                    core.release(child);
+                    return node;
+                }
+                Branch* copy;
+                try {
+                    copy = copyBranch(branch);
+                } catch (...) {
+                    core.release(result);
+                    throw;
+                }
+                core.release(children(copy)[pos]);
+                children(copy)[pos] = result;
+                return copy;
+            }
+            case Kind::leaf: {
+                auto* leaf = static_cast<Leaf*>(node);
+                if (leaf->hash == hash && core.keyEq(leaf->value.first, key)) {
+                    if (!assign) {
+                        return node;
+                    }
+                    if (owned) {
+                        leaf->value.second = std::forward<V>(value);
+                        return node;
+                    }
+                    return makeLeaf(hash, key, std::forward<V>(value));
+                }
+                inserted = true;
+                if (leaf->hash == hash) {
+                    return rebuildCollision(hash, &leaf->value, 1, 1, key, std::forward<V>(value));
+                }
+                Leaf* added = makeLeaf(hash, key, std::forward<V>(value));
+                Core::retain(node);
+                return join(shift, node, leaf->hash, added, hash);
+            }
+            case Kind::collision: {
+                auto* coll = static_cast<Collision*>(node);
+                if (coll->hash != hash) {
+                    inserted = true;
+                    Leaf* added = makeLeaf(hash, key, std::forward<V>(value));
+                    Core::retain(node);
+                    return join(shift, node, coll->hash, added, hash);
+                }
+                for (std::uint32_t i = 0; i < coll->count; ++i) {
+                    if (core.keyEq(entries(coll)[i].first, key)) {
+                        if (!assign) {
+                            return node;
+                        }
+                        if (owned) {
+                            entries(coll)[i].second = std::forward<V>(value);
+                            return node;
+                        }
+                        return rebuildCollision(hash, entries(coll), coll->count, i, key, std::forward<V>(value));
+                    }
+                }
+                inserted = true;
+                return rebuildCollision(hash, entries(coll), coll->count, coll->count, key, std::forward<V>(value));
+            }
+        }
+        return node;
+    }
+
+    // Returns the subtree without `key`: `node` itself, nullptr if it became empty, or a new node,
+    // with the same contract as `assoc`. Branches left holding a single leaf or collision node
+    // collapse into it, so the trie stays as shallow as after inserting the survivors alone.
+    Node* dissoc(Node* node, bool owned, const unsigned shift, const std::uint64_t hash, const Key& key, bool& erased) {
+        owned = owned && unshared(node);
+        switch (node->kind) {
+            case Kind::branch: {
+                auto* branch = static_cast<Branch*>(node);
+                const std::uint32_t bit = slotBit(hash, shift);
+                if (!(branch->bitmap & bit)) {
+                    return node;
+                }
+                const int count = std::popcount(branch->bitmap);
+                const int pos = std::popcount(branch->bitmap & (bit - 1));
+                Node* child = children(branch)[pos];
+                Node* result = dissoc(child, owned, shift + levelBits, hash, key, erased);
+                if (result == child) {
+                    return node;
+                }
+                if (!result) {
+                    if (count == 1) {
+                        return nullptr;
+                    }
+                    if (count == 2) {
+                        if (Node* other = children(branch)[1 - pos]; other->kind != Kind::branch) {
+                            Core::retain(other);
+                            return other;
+                        }
+                    }
+                    return withoutChild(branch, owned, bit);
+                }
+                if (count == 1 && result->kind != Kind::branch) {
+                    return result;
+                }
+                if (owned) {
+                    children(branch)[pos] = result;
+                    core.release(child);
+                    return node;
+                }
+                Branch* copy;
+                try {
+                    copy = copyBranch(branch);
+                } catch (...) {
+                    core.release(result);
+                    throw;
+                }
+                core.release(children(copy)[pos]);
+                children(copy)[pos] = result;
+                return copy;
+            }
+            case Kind::leaf: {
+                auto* leaf = static_cast<Leaf*>(node);
+                if (leaf->hash == hash && core.keyEq(leaf->value.first, key)) {
+                    erased = true;
+                    return nullptr;
+                }
+                return node;
+            }
+            case Kind::collision: {
+                auto* coll = static_cast<Collision*>(node);
+                if (coll->hash != hash) {
+                    return node;
+                }
+                for (std::uint32_t i = 0; i < coll->count; ++i) {
+                    if (core.keyEq(entries(coll)[i].first, key)) {
+                        erased = true;
+                        if (coll->count == 2) {
+                            return makeLeaf(hash, entries(coll)[1 - i]);
+                        }
+                        return rebuildCollision(hash, entries(coll), coll->count, i);
+                    }
+                }
+                return node;
+            }
+        }
+        return node;
+    }
+
+    // Installs `result` as the new root; the replaced root is released outside the lock.
+    void publish(Node* result) noexcept {
+        Node* old = root;
+        root = result;
+        unlock();
+        if (old != result) {
+            core.release(old);
+        }
+    }
+
+    template<typename V>
+    bool set(const Key& key, V&& value, const bool assign) {
+        const std::uint64_t hash = core.hashOf(key);
+        bool inserted = false;
+        lock();
+        Node* result;
+        try {
+            result = root ? assoc(root, true, 0, hash, key, std::forward<V>(value), assign, inserted) : makeLeaf(hash, key, std::forward<V>(value));
+        } catch (...) {
+            unlock();
+            throw;
+        }
+        inserted = inserted || !root;
+        size += inserted;
+        publish(result);
+        return inserted;
+    }
+
+public:
+    explicit PersistentHash(const HashFn& hf = HashFn(), const KeyEqual& eq = KeyEqual(), const Alloc& alloc = Alloc()) : core(hf, eq, alloc) {
+
+    }
+
+    PersistentHash(const PersistentHash&) = delete;
+    PersistentHash& operator=(const PersistentHash&) = delete;
+
+    ~PersistentHash() {
+        core.release(root);
+    }
+
+    [[nodiscard]] size_t getSize() const noexcept {
+        return size;
+    }
+
+    [[nodiscard]] bool isEmpty() const noexcept {
+        return size == 0;
+    }
+
+    // O(1): retains the current root under the lock.
+    Snapshot snapshot() const {
+        lock();
+        Node* current = root;
+        const size_t count = size;
+        if (current) {
+            Core::retain(current);
+        }
+        unlock();
+        return Snapshot(core, current, count);
+    }
+
+    // Inserts if `key` is absent; true if it was inserted.
+    template<typename V>
+    bool insert(const Key& key, V&& value) {
+        return set(key, std::forward<V>(value), false);
+    }
+
+    // Inserts or overwrites; true if the key was new.
+    template<typename V>
+    bool insertOrAssign(const Key& key, V&& value) {
+        return set(key, std::forward<V>(value), true);
+    }
+
+    size_t erase(const Key& key) {
+        if (!root) {
+            return 0;
+        }
+        const std::uint64_t hash = core.hashOf(key);
+        bool erased = false;
+        lock();
+        Node* result;
+        try {
+            result = dissoc(root, true, 0, hash, key, erased);
+        } catch (...) {
+            unlock();
+            throw;
+        }
+        size -= erased;
+        publish(result);
+        return erased;
+    }
+
+    void clear() noexcept {
+        lock();
+        size = 0;
+        publish(nullptr);
+    }
+
+    const T* find(const Key& key) const {
+        const VT* entry = core.lookup(root, core.hashOf(key), key);
+        return entry ? &entry->second : nullptr;
+    }
+
+    bool contains(const Key& key) const {
+        return find(key) != nullptr;
+    }
+
+    const T& get(const Key& key) const {
+        const T* value = find(key);
+        if (!value) {
+            throw std::out_of_range("PersistentHash::get");
+        }
+        return *value;
+    }
+
+    template<typename Fn>
+    void forEach(Fn&& fn) const {
+        Core::visit(root, fn);
+    }
+};
+
+}
+
+#endif // PERSISTENTHASH_H
@@ -0,0 +1,249 @@
+//
+// Created by Ivor_Aif on 2026/10/17.
+//
+
+#ifndef POOL_H
+#define POOL_H
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+namespace mySTL::memory {
+
+namespace detail {
+
+// Requests are rounded up to a multiple of `poolAlign`; anything past `poolMaxSize` bytes, or
+// over-aligned, bypasses the pool.
+constexpr size_t poolAlign = alignof(std::max_align_t);
+constexpr size_t poolClasses = 16;
+constexpr size_t poolMaxSize = poolAlign * poolClasses;
+constexpr size_t poolSlabBytes = 64 * 1024;
+constexpr size_t poolCacheBatch = 32;
+
+struct freeNode {
+    freeNode* next;
+};
+
+constexpr size_t sizeClass(const size_t bytes) noexcept {
+    return bytes ? (bytes - 1) / poolAlign : 0;
+}
+
+// One free list per size class, refilled a slab at a time. Slabs live until the process exits, so
+// blocks may be freed from any thread and in any order.
+class sizeClassPool {
+private:
+    std::mutex lock;
+    freeNode* head = nullptr;
+    size_t blockSize = 0;
+
+    void refill() {
+        auto* slab = static_cast<unsigned char*>(::operator new(poolSlabBytes));
+        const size_t count = poolSlabBytes / blockSize;
+        for (size_t i = count; i-- > 0; ) {
+            auto* node = reinterpret_cast<freeNode*>(slab + i * blockSize);
+            node->next = head;
+            head = node;
+        }
+    }
+
+public:
+    void init(const size_t size) noexcept {
+        blockSize = size;
+    }
+
+    void* take() {
+        std::lock_guard guard(lock);
+        if (!head) {
+            refill();
+        }
+        freeNode* node = head;
+        head = node->next;
+        return node;
+    }
+
+    void give(void* ptr) noexcept {
+        auto* node = static_cast<freeNode*>(ptr);
+        std::lock_guard guard(lock);
+        node->next = head;
+        head = node;
+    }
+
+    // Detaches up to `nn` blocks as a null-terminated chain.
+    freeNode* takeBatch(const size_t nn) {
+        std::lock_guard guard(lock);
+        if (!head) {
+            refill();
+        }
+        freeNode* first = head, * last = head;
+        for (size_t i = 1; i < nn && last->next; ++i) {
+            last = last->next;
+        }
+        head = last->next;
+        last->next = nullptr;
+        return first;
+    }
+
+    void giveBatch(freeNode* first, freeNode* last) noexcept {
+        std::lock_guard guard(lock);
+        last->next = head;
+        head = first;
+    }
+};
+
+inline sizeClassPool& poolFor(const size_t cls) {
+    static sizeClassPool* pools = [] {
+        auto* ret = new sizeClassPool[poolClasses];
+        for (size_t i = 0; i < poolClasses; ++i) {
+            ret[i].init((i + 1) * poolAlign);
+        }
+        return ret;
+    }();
+    return pools[cls];
+}
+
+// Per-thread magazine in front of the shared pools: refills and flushes move `poolCacheBatch`
+// blocks under one lock acquisition. Whatever is left goes back to the pools at thread exit; a
+// thread_local object destroyed after the cache then allocates and frees through the pools directly.
+class threadCache {
+private:
+    freeNode* heads[poolClasses] = {};
+    size_t counts[poolClasses] = {};
+
+    void flush(const size_t cls, size_t keep) noexcept {
+        if (counts[cls] <= keep) {
+            return;
+        }
+        freeNode* first = heads[cls], * last = first;
+        for (size_t i = 1; i < counts[cls] - keep; ++i) {
+            last = last->next;
+        }
+        heads[cls] = last->next;
+        counts[cls] = keep;
+        poolFor(cls).giveBatch(first, last);
+    }
+
+public:
+    threadCache() = default;
+    threadCache(const threadCache&) = delete;
+    threadCache& operator=(const threadCache&) = delete;
+
+    ~threadCache() {
+        for (size_t cls = 0; cls < poolClasses; ++cls) {
+            flush(cls, 0);
+        }
+        destroyed() = true;
+    }
+
+    // Trivially destructible, so it can still be read after the cache itself is gone.
+    static bool& destroyed() noexcept {
+        static thread_local bool flag = false;
+        return flag;
+    }
+
+    void* take(const size_t cls) {
+        if (!heads[cls]) {
+            heads[cls] = poolFor(cls).takeBatch(poolCacheBatch);
+            for (const freeNode* node = heads[cls]; node; node = node->next) {
+                ++counts[cls];
+            }
+        }
+        freeNode* node = heads[cls];
+        heads[cls] = node->next;
+        --counts[cls];
+        return node;
+    }
+
+    void give(const size_t cls, void* ptr) noexcept {
+        auto* node = static_cast<freeNode*>(ptr);
+        node->next = heads[cls];
+        heads[cls] = node;
+        if (++counts[cls] >= 2 * poolCacheBatch) {
+            flush(cls, poolCacheBatch);
+        }
+    }
+
+    static threadCache& local() {
+        static thread_local threadCache cache;
+        return cache;
+    }
+};
+
+}
+
+// Stateless allocator over global size-class pools; every instance is interchangeable, so nodes may
+// be freed through any copy or rebind. `ThreadCache` puts a per-thread cache in front of the pools.
+template<typename T, bool ThreadCache = false>
+class PoolAllocator {
+public:
+    using value_type = T;
+    using is_always_equal = std::true_type;
+
+    template<typename U>
+    struct rebind {
+        using other = PoolAllocator<U, ThreadCache>;
+    };
+
+    PoolAllocator() noexcept = default;
+
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U, ThreadCache>&) noexcept {
+
+    }
+
+    [[nodiscard]] T* allocate(const size_t nn) {
+        const size_t bytes = nn * sizeof(T);
+        if (!pooled(bytes)) {
+            if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                return static_cast<T*>(::operator new(bytes, std::align_val_t(alignof(T))));
+            } else {
+                return static_cast<T*>(::operator new(bytes));
+            }
+        }
+        if constexpr (ThreadCache) {
+            if (!detail::threadCache::destroyed()) {
+                return static_cast<T*>(detail::threadCache::local().take(detail::sizeClass(bytes)));
+            }
+        }
+        return static_cast<T*>(detail::poolFor(detail::sizeClass(bytes)).take());
+    }
+
+    void deallocate(T* ptr, const size_t nn) noexcept {
+        const size_t bytes = nn * sizeof(T);
+        if (!pooled(bytes)) {
+            if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                ::operator delete(ptr, std::align_val_t(alignof(T)));
+            } else {
+                ::operator delete(ptr);
+            }
+            return;
+        }
+        if constexpr (ThreadCache) {
+            if (!detail::threadCache::destroyed()) {
+                detail::threadCache::local().give(detail::sizeClass(bytes), ptr);
+                return;
+            }
+        }
+        detail::poolFor(detail::sizeClass(bytes)).give(ptr);
+    }
+
+    template<typename U>
+    bool operator==(const PoolAllocator<U, ThreadCache>&) const noexcept {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const PoolAllocator<U, ThreadCache>&) const noexcept {
+        return false;
+    }
+
+private:
+    static constexpr bool pooled(const size_t bytes) noexcept {
+        return alignof(T) <= detail::poolAlign && bytes != 0 && bytes <= detail::poolMaxSize;
+    }
+};
+
+}
+
+#endif // POOL_H
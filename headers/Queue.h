@@ -11,13 +11,18 @@
 
 namespace mySTL::structures {
 
-template<typename T, typename Alloc = std::allocator<T>>
+template<typename T, typename Alloc = std::allocator<T>, typename Growth = containers::detail::eagerGrowth>
 class Queue {
 private:
-    containers::detail::conStorage<T, Alloc> data;
+    containers::detail::ringStorage<T, Alloc, Growth> data;
 
 public:
     Queue() = default;
+
+    explicit Queue(const Alloc& alloc) : data(alloc) {
+
+    }
+
     Queue(const Queue&) = default;
     Queue(Queue&&) noexcept(std::is_nothrow_move_constructible_v<Alloc>) = default;
     Queue& operator=(const Queue&) = default;
@@ -32,6 +37,14 @@ public:
         return data.getSize();
     }
 
+    [[nodiscard]] size_t capacity() const noexcept {
+        return data.getCapacity();
+    }
+
+    void reserve(const size_t cap) {
+        data.reserve(cap);
+    }
+
     void clear() noexcept {
         data.clear();
     }
@@ -46,19 +59,22 @@ public:
 
     template<typename... Args>
     T& emplace(Args&&... args) {
-        data.append_(std::forward<Args>(args)...);
-        return back();
+        return data.append_(std::forward<Args>(args)...);
+    }
+
+    template<typename InputIt>
+    void pushRange(InputIt first, InputIt last) {
+        data.appendRange(first, last);
     }
 
     void pop() {
-        if (empty()) {
-            return;
-        }
-        const size_t currentSize = data.getSize();
-        for (size_t i = 1; i < currentSize; ++i) {
-            data[i - 1] = std::move(data[i]);
-        }
-        data.omit();
+        data.omitFront();
+    }
+
+    // Moves up to `nn` elements from the front into `out`, oldest first; returns how many were moved.
+    template<typename OutputIt>
+    size_t popN(const size_t nn, OutputIt out) {
+        return data.takeFront(nn, out);
     }
 
     T& front() {
@@ -86,8 +102,8 @@ public:
     }
 };
 
-template<typename T, typename Alloc>
-void swap(Queue<T, Alloc>& left, Queue<T, Alloc>& right) noexcept {
+template<typename T, typename Alloc, typename Growth>
+void swap(Queue<T, Alloc, Growth>& left, Queue<T, Alloc, Growth>& right) noexcept {
     left.swap(right);
 }
 
@@ -0,0 +1,192 @@
+//
+// Created by Ivor_Aif on 2026/10/17.
+//
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "Array.h"
+#include "Queue.h"
+#include "WorkStealingDequeue.h"
+
+namespace mySTL::parallel {
+
+// Work-stealing thread pool. Every worker owns a `WorkStealingDequeue`: work it spawns goes on its
+// own back end, and idle workers steal from the front of a random victim. Work submitted from
+// outside the pool goes through a shared injection queue. Waiting inside the pool never blocks a
+// worker: `waitFor` runs other tasks until the awaited counter drops to zero.
+class Scheduler {
+private:
+    using Task = std::function<void()>;
+
+    struct Worker {
+        structures::WorkStealingDequeue<Task*> tasks;
+        std::thread thread;
+    };
+
+    containers::Array<std::unique_ptr<Worker>, containers::detail::lazyGrowth> workers;
+    structures::Queue<Task*> injected;
+    std::mutex lock;
+    std::condition_variable ready;
+    std::atomic<size_t> pending{0};
+    bool stopping = false;
+
+    struct Local {
+        Scheduler* owner = nullptr;
+        size_t index = 0;
+        std::uint32_t seed = 0;
+    };
+
+    static Local& local() noexcept {
+        static thread_local Local state;
+        return state;
+    }
+
+    Task* takeInjected() {
+        std::lock_guard guard(lock);
+        if (injected.empty()) {
+            return nullptr;
+        }
+        Task* task = injected.front();
+        injected.pop();
+        return task;
+    }
+
+    Task* steal(Local& self) {
+        const size_t count = workers.getSize();
+        if (count == 0) {
+            return nullptr;
+        }
+        self.seed ^= self.seed << 13;
+        self.seed ^= self.seed >> 17;
+        self.seed ^= self.seed << 5;
+        const size_t start = self.seed % count;
+        Task* task = nullptr;
+        for (size_t i = 0; i < count; ++i) {
+            const size_t victim = (start + i) % count;
+            if ((self.owner != this || victim != self.index) && workers[victim]->tasks.popFront(task)) {
+                return task;
+            }
+        }
+        return nullptr;
+    }
+
+    // Own deque first, then the injection queue, then other workers.
+    Task* find() {
+        Local& self = local();
+        Task* task = nullptr;
+        if (self.owner == this && workers[self.index]->tasks.popBack(task)) {
+            return task;
+        }
+        if ((task = takeInjected())) {
+            return task;
+        }
+        return steal(self);
+    }
+
+    void run(Task* task) {
+        pending.fetch_sub(1, std::memory_order_relaxed);
+        std::unique_ptr<Task> owned(task);
+        (*owned)();
+    }
+
+    void work(const size_t index) {
+        Local& self = local();
+        self.owner = this;
+        self.index = index;
+        self.seed = static_cast<std::uint32_t>(index * 2654435761u + 1);
+        while (true) {
+            if (Task* task = find()) {
+                run(task);
+                continue;
+            }
+            std::unique_lock guard(lock);
+            ready.wait(guard, [this] {
+                return stopping || pending.load(std::memory_order_relaxed) != 0;
+            });
+            if (stopping && pending.load(std::memory_order_relaxed) == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    explicit Scheduler(const size_t count) {
+        workers.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            workers.pushBack(std::make_unique<Worker>());
+        }
+        for (size_t i = 0; i < count; ++i) {
+            workers[i]->thread = std::thread([this, i] {
+                work(i);
+            });
+        }
+    }
+
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+
+    ~Scheduler() {
+        {
+            std::lock_guard guard(lock);
+            stopping = true;
+        }
+        ready.notify_all();
+        for (auto& worker : workers) {
+            worker->thread.join();
+        }
+    }
+
+    [[nodiscard]] size_t getSize() const noexcept {
+        return workers.getSize();
+    }
+
+    // True when the calling thread is one of this scheduler's workers.
+    [[nodiscard]] bool inWorker() const noexcept {
+        return local().owner == this;
+    }
+
+    // `task` must not throw; wrap it if it can (see `parallel::detail::runTasks`).
+    void submit(Task task) {
+        auto* owned = new Task(std::move(task));
+        pending.fetch_add(1, std::memory_order_relaxed);
+        if (Local& self = local(); self.owner == this) {
+            workers[self.index]->tasks.pushBack(owned);
+            // Pairs with the predicate check in `work` so a worker about to sleep sees the task.
+            std::lock_guard guard(lock);
+        } else {
+            std::lock_guard guard(lock);
+            injected.push(owned);
+        }
+        ready.notify_one();
+    }
+
+    // Runs queued tasks on the calling thread until `counter` reaches zero.
+    void waitFor(const std::atomic<size_t>& counter) {
+        while (counter.load(std::memory_order_acquire) != 0) {
+            if (Task* task = find()) {
+                run(task);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    static Scheduler& shared() {
+        static Scheduler scheduler(std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1);
+        return scheduler;
+    }
+};
+
+}
+
+#endif // SCHEDULER_H
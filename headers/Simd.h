@@ -0,0 +1,475 @@
+//
+// Created by Ivor_Aif on 2026/10/17.
+//
+
+#ifndef SIMD_H
+#define SIMD_H
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define MYSTL_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace mySTL::containers::detail {
+
+// Search and reduction kernels behind `Array::find`/`count`/`contains`/`min`/`max`/`sum`.
+// SSE2 is the x86 baseline and AVX2 is picked at runtime; anything else runs the scalar loops.
+
+enum class simdLevel {
+    scalar,
+    sse2,
+    avx2
+};
+
+inline simdLevel simdSupport() noexcept {
+#ifdef MYSTL_SIMD_X86
+    static const simdLevel level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return simdLevel::avx2;
+        }
+        return __builtin_cpu_supports("sse2") ? simdLevel::sse2 : simdLevel::scalar;
+    }();
+    return level;
+#else
+    return simdLevel::scalar;
+#endif
+}
+
+constexpr size_t simdNpos = static_cast<size_t>(-1);
+
+// Element types compared bit for bit (integers, enums, pointers) or with IEEE equality.
+template<typename T>
+constexpr bool isSimdBitwiseV = (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+template<typename T>
+constexpr bool isSimdFloatV = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+template<typename T>
+constexpr bool isSimdSearchableV = isSimdBitwiseV<std::remove_cv_t<T>> || isSimdFloatV<std::remove_cv_t<T>>;
+
+template<typename T>
+constexpr bool isSimdReducibleV = std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && (std::is_integral_v<T> || isSimdFloatV<T>);
+
+template<typename T>
+size_t scalarFind(const T* data, const size_t nn, const T& value) {
+    for (size_t i = 0; i < nn; ++i) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return simdNpos;
+}
+
+template<typename T>
+size_t scalarCount(const T* data, const size_t nn, const T& value) {
+    size_t total = 0;
+    for (size_t i = 0; i < nn; ++i) {
+        total += data[i] == value;
+    }
+    return total;
+}
+
+template<typename T>
+T scalarMin(const T* data, const size_t nn) {
+    T best = data[0];
+    for (size_t i = 1; i < nn; ++i) {
+        if (data[i] < best) {
+            best = data[i];
+        }
+    }
+    return best;
+}
+
+template<typename T>
+T scalarMax(const T* data, const size_t nn) {
+    T best = data[0];
+    for (size_t i = 1; i < nn; ++i) {
+        if (best < data[i]) {
+            best = data[i];
+        }
+    }
+    return best;
+}
+
+template<typename T>
+T scalarSum(const T* data, const size_t nn) {
+    T total{};
+    for (size_t i = 0; i < nn; ++i) {
+        total = total + data[i];
+    }
+    return total;
+}
+
+#ifdef MYSTL_SIMD_X86
+
+// One mask bit per matching byte (bitwise types) or per matching lane (floating point).
+template<typename T>
+struct sse2Match {
+    static constexpr size_t lanes = 16 / sizeof(T);
+    static constexpr size_t laneBits = sizeof(T);
+
+    __m128i needle;
+
+    explicit sse2Match(const T& value) noexcept {
+        if constexpr (sizeof(T) == 1) {
+            char bits;
+            std::memcpy(&bits, &value, 1);
+            needle = _mm_set1_epi8(bits);
+        } else if constexpr (sizeof(T) == 2) {
+            short bits;
+            std::memcpy(&bits, &value, 2);
+            needle = _mm_set1_epi16(bits);
+        } else if constexpr (sizeof(T) == 4) {
+            int bits;
+            std::memcpy(&bits, &value, 4);
+            needle = _mm_set1_epi32(bits);
+        } else {
+            long long bits;
+            std::memcpy(&bits, &value, 8);
+            needle = _mm_set1_epi64x(bits);
+        }
+    }
+
+    unsigned operator()(const T* ptr) const noexcept {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+        if constexpr (sizeof(T) == 1) {
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(block, needle));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_movemask_epi8(_mm_cmpeq_epi16(block, needle));
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm_movemask_epi8(_mm_cmpeq_epi32(block, needle));
+        } else {
+            const __m128i halves = _mm_cmpeq_epi32(block, needle);
+            return _mm_movemask_epi8(_mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1))));
+        }
+    }
+};
+
+template<>
+struct sse2Match<float> {
+    static constexpr size_t lanes = 4;
+    static constexpr size_t laneBits = 1;
+
+    __m128 needle;
+
+    explicit sse2Match(const float value) noexcept : needle(_mm_set1_ps(value)) {
+
+    }
+
+    unsigned operator()(const float* ptr) const noexcept {
+        return _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(ptr), needle));
+    }
+};
+
+template<>
+struct sse2Match<double> {
+    static constexpr size_t lanes = 2;
+    static constexpr size_t laneBits = 1;
+
+    __m128d needle;
+
+    explicit sse2Match(const double value) noexcept : needle(_mm_set1_pd(value)) {
+
+    }
+
+    unsigned operator()(const double* ptr) const noexcept {
+        return _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(ptr), needle));
+    }
+};
+
+template<typename T>
+struct avx2Match {
+    static constexpr size_t lanes = 32 / sizeof(T);
+    static constexpr size_t laneBits = sizeof(T);
+
+    __m256i needle;
+
+    __attribute__((target("avx2"))) explicit avx2Match(const T& value) noexcept {
+        if constexpr (sizeof(T) == 1) {
+            char bits;
+            std::memcpy(&bits, &value, 1);
+            needle = _mm256_set1_epi8(bits);
+        } else if constexpr (sizeof(T) == 2) {
+            short bits;
+            std::memcpy(&bits, &value, 2);
+            needle = _mm256_set1_epi16(bits);
+        } else if constexpr (sizeof(T) == 4) {
+            int bits;
+            std::memcpy(&bits, &value, 4);
+            needle = _mm256_set1_epi32(bits);
+        } else {
+            long long bits;
+            std::memcpy(&bits, &value, 8);
+            needle = _mm256_set1_epi64x(bits);
+        }
+    }
+
+    __attribute__((target("avx2"))) unsigned operator()(const T* ptr) const noexcept {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+        if constexpr (sizeof(T) == 1) {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi16(block, needle));
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi32(block, needle));
+        } else {
+            return _mm256_movemask_epi8(_mm256_cmpeq_epi64(block, needle));
+        }
+    }
+};
+
+template<>
+struct avx2Match<float> {
+    static constexpr size_t lanes = 8;
+    static constexpr size_t laneBits = 1;
+
+    __m256 needle;
+
+    __attribute__((target("avx2"))) explicit avx2Match(const float value) noexcept : needle(_mm256_set1_ps(value)) {
+
+    }
+
+    __attribute__((target("avx2"))) unsigned operator()(const float* ptr) const noexcept {
+        return _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(ptr), needle, _CMP_EQ_OQ));
+    }
+};
+
+template<>
+struct avx2Match<double> {
+    static constexpr size_t lanes = 4;
+    static constexpr size_t laneBits = 1;
+
+    __m256d needle;
+
+    __attribute__((target("avx2"))) explicit avx2Match(const double value) noexcept : needle(_mm256_set1_pd(value)) {
+
+    }
+
+    __attribute__((target("avx2"))) unsigned operator()(const double* ptr) const noexcept {
+        return _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(ptr), needle, _CMP_EQ_OQ));
+    }
+};
+
+template<typename T>
+size_t sse2Find(const T* data, const size_t nn, const T& value) {
+    using match = sse2Match<T>;
+    const match matcher(value);
+    size_t i = 0;
+    for (; i + match::lanes <= nn; i += match::lanes) {
+        if (const unsigned mask = matcher(data + i)) {
+            return i + __builtin_ctz(mask) / match::laneBits;
+        }
+    }
+    const size_t rest = scalarFind(data + i, nn - i, value);
+    return rest == simdNpos ? simdNpos : i + rest;
+}
+
+template<typename T>
+size_t sse2Count(const T* data, const size_t nn, const T& value) {
+    using match = sse2Match<T>;
+    const match matcher(value);
+    size_t total = 0, i = 0;
+    for (; i + match::lanes <= nn; i += match::lanes) {
+        total += __builtin_popcount(matcher(data + i));
+    }
+    return total / match::laneBits + scalarCount(data + i, nn - i, value);
+}
+
+template<typename T>
+__attribute__((target("avx2"))) size_t avx2Find(const T* data, const size_t nn, const T& value) {
+    using match = avx2Match<T>;
+    const match matcher(value);
+    size_t i = 0;
+    for (; i + match::lanes <= nn; i += match::lanes) {
+        if (const unsigned mask = matcher(data + i)) {
+            return i + __builtin_ctz(mask) / match::laneBits;
+        }
+    }
+    const size_t rest = scalarFind(data + i, nn - i, value);
+    return rest == simdNpos ? simdNpos : i + rest;
+}
+
+template<typename T>
+__attribute__((target("avx2"))) size_t avx2Count(const T* data, const size_t nn, const T& value) {
+    using match = avx2Match<T>;
+    const match matcher(value);
+    size_t total = 0, i = 0;
+    for (; i + match::lanes <= nn; i += match::lanes) {
+        total += __builtin_popcount(matcher(data + i));
+    }
+    return total / match::laneBits + scalarCount(data + i, nn - i, value);
+}
+
+// Reductions use the compiler's generic vectors, so the same body compiles to SSE2 or AVX2
+// depending on the caller it is inlined into.
+enum class reduceOp {
+    min,
+    max,
+    sum
+};
+
+template<reduceOp Op, size_t Bytes, typename T>
+[[gnu::always_inline]] inline T reduceBlocks(const T* data, const size_t nn) {
+    typedef T vec __attribute__((vector_size(Bytes)));
+    constexpr size_t lanes = Bytes / sizeof(T);
+    if (nn < lanes) {
+        if constexpr (Op == reduceOp::min) {
+            return scalarMin(data, nn);
+        } else if constexpr (Op == reduceOp::max) {
+            return scalarMax(data, nn);
+        } else {
+            return scalarSum(data, nn);
+        }
+    }
+    vec acc;
+    std::memcpy(&acc, data, Bytes);
+    size_t i = lanes;
+    for (; i + lanes <= nn; i += lanes) {
+        vec block;
+        std::memcpy(&block, data + i, Bytes);
+        if constexpr (Op == reduceOp::min) {
+            acc = block < acc ? block : acc;
+        } else if constexpr (Op == reduceOp::max) {
+            acc = acc < block ? block : acc;
+        } else {
+            acc += block;
+        }
+    }
+    T lane[lanes];
+    std::memcpy(lane, &acc, Bytes);
+    T result = lane[0];
+    for (size_t j = 1; j < lanes; ++j) {
+        if constexpr (Op == reduceOp::min) {
+            result = lane[j] < result ? lane[j] : result;
+        } else if constexpr (Op == reduceOp::max) {
+            result = result < lane[j] ? lane[j] : result;
+        } else {
+            result = result + lane[j];
+        }
+    }
+    for (; i < nn; ++i) {
+        if constexpr (Op == reduceOp::min) {
+            result = data[i] < result ? data[i] : result;
+        } else if constexpr (Op == reduceOp::max) {
+            result = result < data[i] ? data[i] : result;
+        } else {
+            result = result + data[i];
+        }
+    }
+    return result;
+}
+
+template<reduceOp Op, typename T>
+T sse2Reduce(const T* data, const size_t nn) {
+    return reduceBlocks<Op, 16>(data, nn);
+}
+
+template<reduceOp Op, typename T>
+__attribute__((target("avx2"))) T avx2Reduce(const T* data, const size_t nn) {
+    return reduceBlocks<Op, 32>(data, nn);
+}
+
+#endif
+
+template<typename T>
+size_t simdFind(const T* data, const size_t nn, const T& value) {
+#ifdef MYSTL_SIMD_X86
+    if constexpr (isSimdSearchableV<T>) {
+        using U = std::remove_cv_t<T>;
+        switch (simdSupport()) {
+            case simdLevel::avx2:
+                return avx2Find<U>(data, nn, value);
+            case simdLevel::sse2:
+                return sse2Find<U>(data, nn, value);
+            default:
+                break;
+        }
+    }
+#endif
+    return scalarFind(data, nn, value);
+}
+
+template<typename T>
+size_t simdCount(const T* data, const size_t nn, const T& value) {
+#ifdef MYSTL_SIMD_X86
+    if constexpr (isSimdSearchableV<T>) {
+        using U = std::remove_cv_t<T>;
+        switch (simdSupport()) {
+            case simdLevel::avx2:
+                return avx2Count<U>(data, nn, value);
+            case simdLevel::sse2:
+                return sse2Count<U>(data, nn, value);
+            default:
+                break;
+        }
+    }
+#endif
+    return scalarCount(data, nn, value);
+}
+
+template<typename T>
+T simdMin(const T* data, const size_t nn) {
+#ifdef MYSTL_SIMD_X86
+    if constexpr (isSimdReducibleV<T>) {
+        switch (simdSupport()) {
+            case simdLevel::avx2:
+                return avx2Reduce<reduceOp::min>(data, nn);
+            case simdLevel::sse2:
+                return sse2Reduce<reduceOp::min>(data, nn);
+            default:
+                break;
+        }
+    }
+#endif
+    return scalarMin(data, nn);
+}
+
+template<typename T>
+T simdMax(const T* data, const size_t nn) {
+#ifdef MYSTL_SIMD_X86
+    if constexpr (isSimdReducibleV<T>) {
+        switch (simdSupport()) {
+            case simdLevel::avx2:
+                return avx2Reduce<reduceOp::max>(data, nn);
+            case simdLevel::sse2:
+                return sse2Reduce<reduceOp::max>(data, nn);
+            default:
+                break;
+        }
+    }
+#endif
+    return scalarMax(data, nn);
+}
+
+// Floating-point sums are reassociated lane-wise, so the last bits may differ from a sequential loop.
+// Integer sums wrap like the unsigned type of the same width.
+template<typename T>
+T simdSum(const T* data, const size_t nn) {
+#ifdef MYSTL_SIMD_X86
+    if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        using U = std::make_unsigned_t<T>;
+        return static_cast<T>(simdSum(reinterpret_cast<const U*>(data), nn));
+    } else if constexpr (isSimdReducibleV<T>) {
+        if (nn) {
+            switch (simdSupport()) {
+                case simdLevel::avx2:
+                    return avx2Reduce<reduceOp::sum>(data, nn);
+                case simdLevel::sse2:
+                    return sse2Reduce<reduceOp::sum>(data, nn);
+                default:
+                    break;
+            }
+        }
+    }
+#endif
+    return scalarSum(data, nn);
+}
+
+}
+
+#endif // SIMD_H
@@ -11,13 +11,18 @@
 
 namespace mySTL::structures {
 
-template<typename T, typename Alloc = std::allocator<T>>
+template<typename T, typename Alloc = std::allocator<T>, typename Growth = containers::detail::eagerGrowth>
 class Stack {
 private:
-    containers::detail::conStorage<T, Alloc> data;
+    containers::detail::conStorage<T, Alloc, Growth> data;
 
 public:
     Stack() = default;
+
+    explicit Stack(const Alloc& alloc) : data(alloc) {
+
+    }
+
     Stack(const Stack&) = default;
     Stack(Stack&&) noexcept(std::is_nothrow_move_constructible_v<Alloc>) = default;
     Stack& operator=(const Stack&) = default;
@@ -72,8 +77,8 @@ public:
     }
 };
 
-template<typename T, typename Alloc>
-void swap(Stack<T, Alloc>& left, Stack<T, Alloc>& right) noexcept {
+template<typename T, typename Alloc, typename Growth>
+void swap(Stack<T, Alloc, Growth>& left, Stack<T, Alloc, Growth>& right) noexcept {
     left.swap(right);
 }
 
@@ -5,7 +5,11 @@
 #ifndef STRING_H
 #define STRING_H
 
+#include <cstdint>
+#include <string_view>
+
 #include "Array.h"
+#include "Hasher.h"
 
 namespace mySTL::containers {
 
@@ -63,8 +67,8 @@ public:
         const size_t totalLen = nn * subLen;
         reserve(totalLen);
         str.clear();
-        for (size_t i = 0; i < totalLen; ++i) {
-            str.pushBack(subStr[i % subLen]);
+        for (size_t i = 0; i < nn; ++i) {
+            str.append(subStr, subLen);
         }
         str.pushBack('\0');
     }
@@ -72,9 +76,7 @@ public:
     String(const size_t nn, const char ch) {
         reserve(nn);
         str.clear();
-        for (size_t i = 0; i < nn; ++i) {
-            str.pushBack(ch);
-        }
+        str.resize(nn, ch);
         str.pushBack('\0');
     }
 
@@ -94,9 +96,7 @@ public:
         const size_t len = cStrLen(cStr);
         reserve(len);
         str.clear();
-        for (size_t i = 0; i < len; ++i) {
-            str.pushBack(cStr[i]);
-        }
+        str.append(cStr, len);
         str.pushBack('\0');
     }
 
@@ -227,9 +227,7 @@ public:
         const size_t oldLen = length();
         reserve(oldLen + subStr.length());
         str.popBack();
-        for (size_t i = 0; i < subStr.length(); ++i) {
-            str.pushBack(subStr[i]);
-        }
+        str.append(subStr.cStr(), subStr.length());
         str.pushBack('\0');
     }
 
@@ -246,9 +244,7 @@ public:
         const size_t oldLen = length();
         reserve(oldLen + subLen);
         str.popBack();
-        for (size_t i = 0; i < subLen; ++i) {
-            str.pushBack(cStr[i]);
-        }
+        str.append(cStr, subLen);
         str.pushBack('\0');
     }
 
@@ -259,9 +255,7 @@ public:
         const size_t oldLen = length();
         reserve(oldLen + nn);
         str.popBack();
-        for (size_t i = 0; i < nn; ++i) {
-            str.pushBack(ch);
-        }
+        str.resize(oldLen + nn, ch);
         str.pushBack('\0');
     }
 
@@ -295,17 +289,7 @@ public:
         const size_t oldLen = length();
         const size_t insLen = subStr.length();
         reserve(oldLen + insLen);
-        str.popBack();
-        for (size_t i = 0; i < insLen; ++i) {
-            str.pushBack('\0');
-        }
-        for (size_t i = oldLen; i > pos; --i) {
-            str[i + insLen - 1] = str[i - 1];
-        }
-        for (size_t i = 0; i < insLen; ++i) {
-            str[pos + i] = subStr[i];
-        }
-        str.pushBack('\0');
+        str.insert(pos, subStr.begin(), subStr.end());
     }
 
     void insert(const size_t pos, const char* cStr) {
@@ -323,17 +307,7 @@ public:
         }
         const size_t oldLen = length();
         reserve(oldLen + insLen);
-        str.popBack();
-        for (size_t i = 0; i < insLen; ++i) {
-            str.pushBack('\0');
-        }
-        for (size_t i = oldLen; i > pos; --i) {
-            str[i + insLen - 1] = str[i - 1];
-        }
-        for (size_t i = 0; i < insLen; ++i) {
-            str[pos + i] = cStr[i];
-        }
-        str.pushBack('\0');
+        str.insert(pos, cStr, cStr + insLen);
     }
 
     void insert(const size_t pos, const size_t nn, const char ch) {
@@ -441,9 +415,7 @@ public:
         String ret;
         ret.reserve(len);
         ret.str.clear();
-        for (size_t i = 0; i < len; ++i) {
-            ret.str.pushBack(str[pos + i]);
-        }
+        ret.str.append(str.getData() + pos, len);
         ret.str.pushBack('\0');
         return ret;
     }
@@ -455,12 +427,8 @@ public:
     }
 
     [[nodiscard]] size_t find(const char ch, const size_t pos = 0) const {
-        for (size_t i = pos; i < length(); ++i) {
-            if (str[i] == ch) {
-                return i;
-            }
-        }
-        return static_cast<size_t>(-1);
+        const size_t idx = str.find(ch, pos);
+        return idx < length() ? idx : static_cast<size_t>(-1);
     }
 
     [[nodiscard]] size_t find(const String& subStr, const size_t pos = 0) const {
@@ -512,6 +480,10 @@ public:
         return compare(other) == 0;
     }
 
+    bool operator==(const char* cStr) const {
+        return std::string_view(str.getData(), length()) == std::string_view(cStr);
+    }
+
     bool operator!=(const String& other) const {
         return compare(other) != 0;
     }
@@ -545,6 +517,65 @@ inline void swap(String& str1, String& str2) noexcept {
     str1.swap(str2);
 }
 
+// Transparent hash and equality for `Hash<String, T, StringHash, StringEqual>`: lookups by
+// `const char*` or `std::string_view` hash the characters in place instead of building a String.
+struct StringHash {
+    using is_transparent = void;
+    using is_avalanching = void;
+
+    static size_t hashBytes(const std::string_view view) noexcept {
+        return static_cast<size_t>(hash::hashBytes(view));
+    }
+
+    size_t operator()(const String& str) const noexcept {
+        return hashBytes(std::string_view(str.cStr(), str.length()));
+    }
+
+    size_t operator()(const std::string_view view) const noexcept {
+        return hashBytes(view);
+    }
+
+    size_t operator()(const char* cStr) const noexcept {
+        return hashBytes(std::string_view(cStr));
+    }
+};
+
+struct StringEqual {
+    using is_transparent = void;
+
+    static std::string_view view(const String& str) noexcept {
+        return { str.cStr(), str.length() };
+    }
+
+    static std::string_view view(const std::string_view str) noexcept {
+        return str;
+    }
+
+    static std::string_view view(const char* str) noexcept {
+        return str;
+    }
+
+    template<typename L, typename R>
+    bool operator()(const L& left, const R& right) const noexcept {
+        return view(left) == view(right);
+    }
+};
+
+template<>
+struct detail::isTriviallyRelocatable<String> : isTriviallyRelocatable<Array<char>> {
+
+};
+
 }
 
+template<>
+struct std::hash<mySTL::containers::String> : mySTL::containers::StringHash {
+
+};
+
+template<>
+struct mySTL::hash::Hasher<mySTL::containers::String> : mySTL::containers::StringHash {
+
+};
+
 #endif // STRING_H
@@ -9,19 +9,33 @@
 
 namespace mySTL::structures {
 
-template<typename T, typename Alloc = std::allocator<T>>
+// `Inline` > 0 keeps up to that many keys/children per node inside the node (`SmallArray`).
+template<typename T, typename Alloc = std::allocator<T>, size_t Inline = 0>
 class Trie {
 public:
+    template<typename U>
+    using NodeArrayAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<U>;
+
+    template<typename U>
+    using NodeArray = std::conditional_t<Inline == 0,
+        containers::Array<U, containers::detail::lazyGrowth, containers::detail::conStorage<U, NodeArrayAlloc<U>, containers::detail::lazyGrowth>>,
+        containers::Array<U, containers::detail::eagerGrowth, containers::detail::smallStorage<U, Inline == 0 ? 1 : Inline, NodeArrayAlloc<U>>>>;
+
     struct Node {
         bool isEnd = false;
         Node* parent = nullptr;
-        containers::Array<T> keys;
-        containers::Array<Node*> children;
+        NodeArray<T> keys;
+        NodeArray<Node*> children;
 
         explicit Node(Node* pat) : parent(pat) {
 
         }
 
+        template<typename NodeAllocT>
+        Node(Node* pat, const NodeAllocT& alloc) : parent(pat), keys(NodeArrayAlloc<T>(alloc)), children(NodeArrayAlloc<Node*>(alloc)) {
+
+        }
+
         containers::detail::KeyValue<size_t, bool> findKey(const T& key) const {
             if (keys.empty()) {
                 return {0, false};
@@ -48,7 +62,7 @@ private:
     Node* createNode(Node* parent, Args&&... args) {
         Node* node = NodeAllocTraits::allocate(nodeAlloc, 1);
         try {
-            NodeAllocTraits::construct(nodeAlloc, node, parent, std::forward<Args>(args)...);
+            NodeAllocTraits::construct(nodeAlloc, node, parent, nodeAlloc, std::forward<Args>(args)...);
             nodeCount++;
         } catch (...) {
             NodeAllocTraits::deallocate(nodeAlloc, node, 1);
@@ -68,7 +82,11 @@ private:
         }
     }
 
+    // Every caller resets `nodeCount` afterwards, so a monotonic allocator can skip the walk.
     void destroySubtree(Node* node) noexcept {
+        if constexpr (containers::detail::isMonotonicAllocV<NodeAlloc> && std::is_trivially_destructible_v<T>) {
+            return;
+        }
         if (!node) {
             return;
         }
@@ -547,13 +565,13 @@ public:
     }
 };
 
-template<typename T, typename Alloc>
-bool Trie<T, Alloc>::Iterator::operator==(const typename Trie<T, Alloc>::ConstIterator& other) const {
+template<typename T, typename Alloc, size_t Inline>
+bool Trie<T, Alloc, Inline>::Iterator::operator==(const typename Trie<T, Alloc, Inline>::ConstIterator& other) const {
     return current == other.current;
 }
 
-template<typename T, typename Alloc>
-bool Trie<T, Alloc>::Iterator::operator!=(const typename Trie<T, Alloc>::ConstIterator& other) const {
+template<typename T, typename Alloc, size_t Inline>
+bool Trie<T, Alloc, Inline>::Iterator::operator!=(const typename Trie<T, Alloc, Inline>::ConstIterator& other) const {
     return !(*this == other);
 }
 
@@ -0,0 +1,603 @@
+//
+// Created by Ivor_Aif on 2026/10/18.
+//
+
+#ifndef UNROLLEDLIST_H
+#define UNROLLEDLIST_H
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#include "Containers.h"
+
+namespace mySTL::containers {
+
+namespace detail {
+
+// Elements per block so that a block, links and count included, spans about four cache lines.
+template<typename T>
+constexpr size_t defaultUnrollSize = std::max<size_t>(4, (256 - 3 * sizeof(void*)) / sizeof(T));
+
+}
+
+// Doubly linked list of blocks, each holding up to K elements packed at its front. Walking the list
+// touches one block per K elements instead of one node per element, and a `List<int>` node's two
+// links are amortized over the whole block.
+//
+// The API follows `List`, but elements live inside blocks, so iterators are a block and an index:
+// insert and erase invalidate iterators into the blocks they touch (a full block is split in half,
+// and neighbouring blocks that drop to K / 2 elements between them are merged). Splicing whole blocks
+// requires allocators that compare equal, as with `List`; it may split the block at `pos`, which
+// allocates.
+template<typename T, typename Alloc = std::allocator<T>, size_t K = detail::defaultUnrollSize<T>>
+class UnrolledList {
+    static_assert(K >= 2, "K must be at least 2");
+
+private:
+    struct Link {
+        Link* last;
+        Link* next;
+        size_t count;
+    };
+
+    struct Block : Link {
+        alignas(T) unsigned char storage[K * sizeof(T)];
+    };
+
+    using allocTraits = std::allocator_traits<Alloc>;
+    using BlockAlloc = typename allocTraits::template rebind_alloc<Block>;
+    using blockTraits = std::allocator_traits<BlockAlloc>;
+
+    Link* sentinel;
+    size_t len = 0;
+    Alloc alloc;
+
+    static T* slot(Link* block, const size_t index) noexcept {
+        return reinterpret_cast<T*>(static_cast<Block*>(block)->storage) + index;
+    }
+
+    // Links a new, empty block in front of `pos`.
+    Link* linkBlock(Link* pos) {
+        BlockAlloc blockAlloc(alloc);
+        Block* block = blockTraits::allocate(blockAlloc, 1);
+        ::new (static_cast<void*>(block)) Block;
+        block->count = 0;
+        block->last = pos->last;
+        block->next = pos;
+        pos->last->next = block;
+        pos->last = block;
+        return block;
+    }
+
+    // Unlinks and frees a block whose elements are already gone.
+    void dropBlock(Link* block) noexcept {
+        block->last->next = block->next;
+        block->next->last = block->last;
+        BlockAlloc blockAlloc(alloc);
+        blockTraits::deallocate(blockAlloc, static_cast<Block*>(block), 1);
+    }
+
+    // Shifts [index, count) up by one, leaving slot `index` unconstructed.
+    void openGap(Link* block, const size_t index) {
+        if (index < block->count) {
+            if constexpr (detail::isTriviallyRelocatableV<T>) {
+                std::memmove(static_cast<void*>(slot(block, index + 1)), static_cast<const void*>(slot(block, index)), (block->count - index) * sizeof(T));
+            } else {
+                allocTraits::construct(alloc, slot(block, block->count), std::move_if_noexcept(*slot(block, block->count - 1)));
+                std::move_backward(slot(block, index), slot(block, block->count - 1), slot(block, block->count));
+                allocTraits::destroy(alloc, slot(block, index));
+            }
+        }
+        ++block->count;
+    }
+
+    // Shifts [index + 1, count) down by one over the unconstructed slot `index`.
+    void closeGap(Link* block, const size_t index) {
+        if (index + 1 < block->count) {
+            if constexpr (detail::isTriviallyRelocatableV<T>) {
+                std::memmove(static_cast<void*>(slot(block, index)), static_cast<const void*>(slot(block, index + 1)), (block->count - index - 1) * sizeof(T));
+            } else {
+                allocTraits::construct(alloc, slot(block, index), std::move_if_noexcept(*slot(block, index + 1)));
+                std::move(slot(block, index + 2), slot(block, block->count), slot(block, index + 1));
+                allocTraits::destroy(alloc, slot(block, block->count - 1));
+            }
+        }
+        --block->count;
+    }
+
+    // Moves [at, count) of `block` into a new block linked right after it.
+    Link* splitBlock(Link* block, const size_t at) {
+        Link* right = linkBlock(block->next);
+        try {
+            detail::relocateN(alloc, slot(block, at), block->count - at, slot(right, 0));
+        } catch (...) {
+            dropBlock(right);
+            throw;
+        }
+        right->count = block->count - at;
+        block->count = at;
+        return right;
+    }
+
+    // Appends the elements of the block after `block` to it and frees that block.
+    void absorbNext(Link* block) {
+        Link* next = block->next;
+        detail::relocateN(alloc, slot(next, 0), next->count, slot(block, block->count));
+        block->count += next->count;
+        dropBlock(next);
+    }
+
+public:
+    template<bool IsConst>
+    class IteratorBase;
+    using Iterator = IteratorBase<false>;
+    using ConstIterator = IteratorBase<true>;
+
+    UnrolledList() : UnrolledList(Alloc()) {
+
+    }
+
+    explicit UnrolledList(const Alloc& a) : alloc(a) {
+        sentinel = static_cast<Link*>(operator new(sizeof(Link)));
+        sentinel->last = sentinel;
+        sentinel->next = sentinel;
+        sentinel->count = 0;
+    }
+
+    UnrolledList(const UnrolledList& other) : UnrolledList(allocTraits::select_on_container_copy_construction(other.alloc)) {
+        for (const auto& element : other) {
+            pushBack(element);
+        }
+    }
+
+    UnrolledList(UnrolledList&& other) noexcept : UnrolledList(other.alloc) {
+        swap(other);
+    }
+
+    UnrolledList& operator=(const UnrolledList& other) {
+        if (this != &other) {
+            UnrolledList tmp(other);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    UnrolledList& operator=(UnrolledList&& other) noexcept {
+        if (this != &other) {
+            UnrolledList tmp(std::move(other));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    ~UnrolledList() noexcept {
+        clear();
+        operator delete(sentinel);
+    }
+
+    void swap(UnrolledList& other) noexcept {
+        std::swap(sentinel, other.sentinel);
+        std::swap(len, other.len);
+        std::swap(alloc, other.alloc);
+    }
+
+    [[nodiscard]] size_t length() const noexcept {
+        return len;
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return len == 0;
+    }
+
+    void clear() noexcept {
+        Link* curr = sentinel->next;
+        while (curr != sentinel) {
+            Link* nxt = curr->next;
+            if constexpr (!std::is_trivially_destructible_v<T>) {
+                for (size_t i = 0; i < curr->count; ++i) {
+                    allocTraits::destroy(alloc, slot(curr, i));
+                }
+            }
+            BlockAlloc blockAlloc(alloc);
+            blockTraits::deallocate(blockAlloc, static_cast<Block*>(curr), 1);
+            curr = nxt;
+        }
+        sentinel->last = sentinel;
+        sentinel->next = sentinel;
+        len = 0;
+    }
+
+    // Constructs an element before `pos`. An element inserted at the start of a block goes to the
+    // end of the previous block while that has room, so runs of pushBack fill blocks completely.
+    template<typename... Args>
+    Iterator emplace(Iterator pos, Args&&... args) {
+        Link* block = pos.block;
+        size_t index = pos.index;
+        if (index == 0 && block->last != sentinel && block->last->count < K) {
+            block = block->last;
+            index = block->count;
+            allocTraits::construct(alloc, slot(block, index), std::forward<Args>(args)...);
+            ++block->count;
+            ++len;
+            return Iterator(block, index);
+        }
+        // The arguments may refer to an element that is about to be shifted or split off.
+        T value(std::forward<Args>(args)...);
+        if (index == 0 && (block == sentinel || block->count == K)) {
+            block = linkBlock(block);
+        } else if (block->count == K) {
+            Link* right = splitBlock(block, K / 2);
+            if (index > K / 2) {
+                block = right;
+                index -= K / 2;
+            }
+        }
+        openGap(block, index);
+        try {
+            allocTraits::construct(alloc, slot(block, index), std::move(value));
+        } catch (...) {
+            closeGap(block, index);
+            if (block->count == 0) {
+                dropBlock(block);
+            }
+            throw;
+        }
+        ++len;
+        return Iterator(block, index);
+    }
+
+    Iterator insert(Iterator pos, const T& value, const bool front = true) {
+        if (!front) {
+            pos = pos.block == sentinel ? begin() : std::next(pos);
+        }
+        return emplace(pos, value);
+    }
+
+    Iterator insert(Iterator pos, T&& value, const bool front = true) {
+        if (!front) {
+            pos = pos.block == sentinel ? begin() : std::next(pos);
+        }
+        return emplace(pos, std::move(value));
+    }
+
+    // Returns the element after the erased one.
+    Iterator erase(Iterator pos) {
+        Link* block = pos.block;
+        size_t index = pos.index;
+        if (block == sentinel) {
+            return end();
+        }
+        allocTraits::destroy(alloc, slot(block, index));
+        closeGap(block, index);
+        --len;
+        if (block->count == 0) {
+            Link* nxt = block->next;
+            dropBlock(block);
+            return Iterator(nxt, 0);
+        }
+        if (block->next != sentinel && block->count + block->next->count <= K / 2) {
+            absorbNext(block);
+        }
+        if (block->last != sentinel && block->last->count + block->count <= K / 2) {
+            Link* prev = block->last;
+            index += prev->count;
+            absorbNext(prev);
+            block = prev;
+        }
+        return index < block->count ? Iterator(block, index) : Iterator(block->next, 0);
+    }
+
+    Iterator find(const T& value) {
+        for (auto it = begin(); it != end(); ++it) {
+            if (*it == value) {
+                return it;
+            }
+        }
+        return end();
+    }
+
+    ConstIterator find(const T& value) const {
+        for (auto it = begin(); it != end(); ++it) {
+            if (*it == value) {
+                return it;
+            }
+        }
+        return endConst();
+    }
+
+    void pushBack(const T& value) {
+        emplace(end(), value);
+    }
+
+    void pushBack(T&& value) {
+        emplace(end(), std::move(value));
+    }
+
+    void popBack() {
+        if (!empty()) {
+            erase(Iterator(sentinel->last, sentinel->last->count - 1));
+        }
+    }
+
+    void pushFront(const T& value) {
+        emplace(begin(), value);
+    }
+
+    void pushFront(T&& value) {
+        emplace(begin(), std::move(value));
+    }
+
+    void popFront() {
+        if (!empty()) {
+            erase(begin());
+        }
+    }
+
+    Iterator begin() noexcept {
+        return Iterator(sentinel->next, 0);
+    }
+
+    Iterator end() noexcept {
+        return Iterator(sentinel, 0);
+    }
+
+    ConstIterator begin() const noexcept {
+        return ConstIterator(sentinel->next, 0);
+    }
+
+    ConstIterator end() const noexcept {
+        return ConstIterator(sentinel, 0);
+    }
+
+    ConstIterator beginConst() const noexcept {
+        return begin();
+    }
+
+    ConstIterator endConst() const noexcept {
+        return end();
+    }
+
+    T& front() {
+        assert(!empty());
+        return *slot(sentinel->next, 0);
+    }
+
+    const T& front() const {
+        assert(!empty());
+        return *slot(sentinel->next, 0);
+    }
+
+    T& back() {
+        assert(!empty());
+        return *slot(sentinel->last, sentinel->last->count - 1);
+    }
+
+    const T& back() const {
+        assert(!empty());
+        return *slot(sentinel->last, sentinel->last->count - 1);
+    }
+
+    // Moves the single element at `it` from `other`; the element itself is moved, so the
+    // allocators need not compare equal.
+    void splice(Iterator pos, UnrolledList& other, Iterator it) {
+        if (this == &other || it.block == other.sentinel) {
+            return;
+        }
+        emplace(pos, std::move(*it));
+        other.erase(it);
+    }
+
+    void splice(Iterator pos, UnrolledList& other) {
+        if (this == &other || other.empty()) {
+            return;
+        }
+        Link* cur = splitAt(pos, {});
+        Link* head = other.sentinel->next, * tail = other.sentinel->last;
+        other.sentinel->next = other.sentinel;
+        other.sentinel->last = other.sentinel;
+        head->last = cur->last;
+        tail->next = cur;
+        cur->last->next = head;
+        cur->last = tail;
+        len += other.len;
+        other.len = 0;
+    }
+
+    // Moves [head, tail) of `other` before `pos` by splitting blocks at the three positions and
+    // relinking the whole blocks in between.
+    void splice(Iterator pos, UnrolledList& other, Iterator head, Iterator tail) {
+        if (head == tail || (this == &other && pos == head)) {
+            return;
+        }
+        Link* cur = splitAt(pos, { &head, &tail });
+        Link* last = other.splitAt(tail, { &head });
+        Link* first = other.splitAt(head, {});
+        Link* lastBlock = last->last;
+        size_t nn = 0;
+        for (Link* block = first; block != last; block = block->next) {
+            nn += block->count;
+        }
+        first->last->next = last;
+        last->last = first->last;
+        first->last = cur->last;
+        lastBlock->next = cur;
+        cur->last->next = first;
+        cur->last = lastBlock;
+        len += nn;
+        other.len -= nn;
+    }
+
+    void merge(UnrolledList& other) {
+        merge(other, std::less<T>{});
+    }
+
+    // Stable; the merged elements are repacked into full blocks and `other` is left empty.
+    template<typename Compare>
+    void merge(UnrolledList& other, Compare cmp) {
+        if (this == &other || other.empty()) {
+            return;
+        }
+        UnrolledList merged(alloc);
+        Iterator it1 = begin(), it2 = other.begin();
+        while (it1 != end() && it2 != other.end()) {
+            if (cmp(*it2, *it1)) {
+                merged.pushBack(std::move(*it2++));
+            } else {
+                merged.pushBack(std::move(*it1++));
+            }
+        }
+        for (; it1 != end(); ++it1) {
+            merged.pushBack(std::move(*it1));
+        }
+        for (; it2 != other.end(); ++it2) {
+            merged.pushBack(std::move(*it2));
+        }
+        other.clear();
+        swap(merged);
+    }
+
+    void sort() {
+        sort(std::less<T>{});
+    }
+
+    // Stable. The elements are relocated into one buffer, sorted there and relocated back into the
+    // same blocks, so the block layout does not change.
+    template<typename Compare>
+    void sort(Compare comp) {
+        if (len < 2) {
+            return;
+        }
+        T* buffer = allocTraits::allocate(alloc, len);
+        size_t moved = 0;
+        // Relocates the first `count` buffered elements back into the blocks they came from.
+        auto restore = [&](const size_t count) {
+            size_t offset = 0;
+            for (Link* block = sentinel->next; offset < count; block = block->next) {
+                detail::relocateN(alloc, buffer + offset, block->count, slot(block, 0));
+                offset += block->count;
+            }
+            allocTraits::deallocate(alloc, buffer, len);
+        };
+        try {
+            for (Link* block = sentinel->next; block != sentinel; block = block->next) {
+                detail::relocateN(alloc, slot(block, 0), block->count, buffer + moved);
+                moved += block->count;
+            }
+            std::stable_sort(buffer, buffer + len, comp);
+        } catch (...) {
+            restore(moved);
+            throw;
+        }
+        restore(len);
+    }
+
+    template<bool IsConst>
+    class IteratorBase {
+        friend class UnrolledList;
+
+        template<bool>
+        friend class IteratorBase;
+
+    private:
+        Link* block = nullptr;
+        size_t index = 0;
+
+        IteratorBase(Link* block, const size_t index) : block(block), index(index) {
+
+        }
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IsConst, const T*, T*>;
+        using reference = std::conditional_t<IsConst, const T&, T&>;
+
+        IteratorBase() = default;
+
+        template<bool OtherConst, std::enable_if_t<IsConst && !OtherConst>* = nullptr>
+        IteratorBase(const IteratorBase<OtherConst>& other) : block(other.block), index(other.index) {
+
+        }
+
+        reference operator*() const {
+            return *slot(block, index);
+        }
+
+        pointer operator->() const {
+            return slot(block, index);
+        }
+
+        IteratorBase& operator++() {
+            if (++index == block->count) {
+                block = block->next;
+                index = 0;
+            }
+            return *this;
+        }
+
+        IteratorBase operator++(int) {
+            IteratorBase tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        IteratorBase& operator--() {
+            if (index == 0) {
+                block = block->last;
+                index = block->count;
+            }
+            --index;
+            return *this;
+        }
+
+        IteratorBase operator--(int) {
+            IteratorBase tmp = *this;
+            --*this;
+            return tmp;
+        }
+
+        bool operator==(const IteratorBase& other) const {
+            return block == other.block && index == other.index;
+        }
+
+        bool operator!=(const IteratorBase& other) const {
+            return !(*this == other);
+        }
+    };
+
+private:
+    // Makes `pos` the first element of its block and returns that block (the sentinel for `end()`).
+    // Iterators in `fix` that pointed past `pos` in the same block are moved to the new block.
+    Link* splitAt(const Iterator pos, const std::initializer_list<Iterator*> fix) {
+        if (pos.index == 0) {
+            return pos.block;
+        }
+        Link* right = splitBlock(pos.block, pos.index);
+        for (Iterator* it : fix) {
+            if (it->block == pos.block && it->index >= pos.index) {
+                it->block = right;
+                it->index -= pos.index;
+            }
+        }
+        return right;
+    }
+};
+
+template<typename T, typename Alloc, size_t K>
+void swap(UnrolledList<T, Alloc, K>& left, UnrolledList<T, Alloc, K>& right) noexcept {
+    left.swap(right);
+}
+
+template<typename T, typename Alloc, size_t K>
+struct detail::isTriviallyRelocatable<UnrolledList<T, Alloc, K>> : std::bool_constant<std::is_empty_v<Alloc>> {
+
+};
+
+}
+
+#endif // UNROLLEDLIST_H
@@ -0,0 +1,139 @@
+//
+// Created by Ivor_Aif on 2026/10/17.
+//
+
+#ifndef WORKSTEALINGDEQUEUE_H
+#define WORKSTEALINGDEQUEUE_H
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+
+#include "Array.h"
+
+namespace mySTL::structures {
+
+// Chase-Lev work-stealing deque (Lê et al., "Correct and Efficient Work-Stealing for Weak Memory
+// Models"). The owning thread uses `pushBack`/`popBack` like a stack; any other thread may take the
+// oldest element with `popFront`. `T` is copied through atomics, so it must be trivially copyable
+// (typically a pointer to a task).
+template<typename T>
+class WorkStealingDequeue {
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDequeue needs a trivially copyable element");
+
+private:
+    struct Ring {
+        std::int64_t mask;
+        std::atomic<T>* items;
+
+        explicit Ring(const std::int64_t cap) : mask(cap - 1), items(new std::atomic<T>[cap]) {
+
+        }
+
+        ~Ring() {
+            delete[] items;
+        }
+
+        T get(const std::int64_t idx) const noexcept {
+            return items[idx & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(const std::int64_t idx, const T& value) noexcept {
+            items[idx & mask].store(value, std::memory_order_relaxed);
+        }
+    };
+
+    alignas(containers::detail::cacheLineSize) std::atomic<std::int64_t> top{0};
+    alignas(containers::detail::cacheLineSize) std::atomic<std::int64_t> bottom{0};
+    std::atomic<Ring*> ring;
+    // Thieves may still be reading a ring after it is replaced, so old rings live until destruction.
+    containers::Array<Ring*, containers::detail::lazyGrowth> retired;
+
+    Ring* grow(Ring* old, const std::int64_t b, const std::int64_t t) {
+        auto* bigger = new Ring(2 * (old->mask + 1));
+        for (std::int64_t i = t; i < b; ++i) {
+            bigger->put(i, old->get(i));
+        }
+        retired.pushBack(old);
+        ring.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+
+public:
+    explicit WorkStealingDequeue(const size_t cap = 64) : ring(new Ring(static_cast<std::int64_t>(std::bit_ceil(cap < 2 ? size_t(2) : cap)))) {
+
+    }
+
+    WorkStealingDequeue(const WorkStealingDequeue&) = delete;
+    WorkStealingDequeue& operator=(const WorkStealingDequeue&) = delete;
+
+    ~WorkStealingDequeue() {
+        delete ring.load(std::memory_order_relaxed);
+        for (Ring* old : retired) {
+            delete old;
+        }
+    }
+
+    [[nodiscard]] size_t sizeApprox() const noexcept {
+        const std::int64_t b = bottom.load(std::memory_order_relaxed), t = top.load(std::memory_order_relaxed);
+        return b > t ? static_cast<size_t>(b - t) : 0;
+    }
+
+    [[nodiscard]] bool emptyApprox() const noexcept {
+        return sizeApprox() == 0;
+    }
+
+    // Owner only.
+    void pushBack(const T& value) {
+        const std::int64_t b = bottom.load(std::memory_order_relaxed);
+        const std::int64_t t = top.load(std::memory_order_acquire);
+        Ring* r = ring.load(std::memory_order_relaxed);
+        if (b - t > r->mask) {
+            r = grow(r, b, t);
+        }
+        r->put(b, value);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    // Owner only. Takes the newest element.
+    bool popBack(T& out) {
+        const std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        Ring* r = ring.load(std::memory_order_relaxed);
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return false;
+        }
+        out = r->get(b);
+        if (t == b) {
+            // Last element: race the thieves for it.
+            const bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return won;
+        }
+        return true;
+    }
+
+    // Any thread. Takes the oldest element; fails if empty or if it lost a race.
+    bool popFront(T& out) {
+        std::int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return false;
+        }
+        const T value = ring.load(std::memory_order_acquire)->get(t);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return false;
+        }
+        out = value;
+        return true;
+    }
+};
+
+}
+
+#endif // WORKSTEALINGDEQUEUE_H
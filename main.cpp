@@ -1,4 +1,7 @@
+#include <atomic>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include "headers/Array.h"
 #include "headers/List.h"
@@ -11,10 +14,118 @@
 #include "headers/BiTree.h"
 #include "headers/Trie.h"
 #include "headers/Heap.h"
+#include "headers/Parallel.h"
+#include "headers/ConcurrentStack.h"
+#include "headers/UnrolledList.h"
+#include "headers/PersistentHash.h"
+#include "headers/FlatHash.h"
 
 using namespace mySTL::containers;
 using namespace mySTL::structures;
 
+// Producers push disjoint ranges while consumers pop concurrently; every value must come out
+// exactly once. Build with -fsanitize=thread or -fsanitize=address to check the reclamation too.
+template<bool Elimination>
+void stressConcurrentStack(const size_t producers, const size_t consumers, const size_t perProducer) {
+    ConcurrentStack<size_t, Elimination> stack;
+    const size_t total = producers * perProducer;
+    std::vector<std::atomic<unsigned>> seen(total);
+    std::atomic<size_t> popped(0);
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p] {
+            for (size_t i = 0; i < perProducer; ++i) {
+                stack.push(p * perProducer + i);
+            }
+        });
+    }
+    for (size_t c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            size_t value;
+            while (popped.load(std::memory_order_relaxed) < total) {
+                if (stack.tryPop(value)) {
+                    seen[value].fetch_add(1, std::memory_order_relaxed);
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    size_t value;
+    assert(!stack.tryPop(value));
+    assert(popped.load() == total);
+    for (size_t i = 0; i < total; ++i) {
+        assert(seen[i].load() == 1);
+    }
+}
+
+// Elements of `list` in order, to compare against the expected sequence.
+template<typename T, typename Alloc, size_t K>
+std::vector<T> contents(const UnrolledList<T, Alloc, K>& list) {
+    std::vector<T> out(list.begin(), list.end());
+    assert(out.size() == list.length());
+    return out;
+}
+
+struct Tagged {
+    int key;
+    int tag;
+};
+
+// Hashes a key to itself shifted up, and claims to avalanche so `PersistentHash` uses it as is:
+// small keys then agree on every level's bits but the last few, and `key % 4` decides the rest.
+struct PrefixHash {
+    using is_avalanching = void;
+
+    size_t operator()(const int key) const noexcept {
+        return static_cast<size_t>(key % 4) << 40;
+    }
+};
+
+// Claims to avalanche, so `FlatHash` probes with the key itself: every key below 128 starts in the
+// first control group, in the first free slot.
+struct IdentityHash {
+    using is_avalanching = void;
+
+    size_t operator()(const int key) const noexcept {
+        return static_cast<size_t>(key);
+    }
+};
+
+// Counts the bytes it hands out, so tests can see which nodes a container still holds.
+inline long countedBytes = 0;
+
+template<typename T>
+struct CountingAlloc {
+    using value_type = T;
+
+    CountingAlloc() = default;
+
+    template<typename U>
+    CountingAlloc(const CountingAlloc<U>&) noexcept {
+
+    }
+
+    T* allocate(const size_t nn) {
+        countedBytes += static_cast<long>(nn * sizeof(T));
+        return std::allocator<T>().allocate(nn);
+    }
+
+    void deallocate(T* ptr, const size_t nn) noexcept {
+        countedBytes -= static_cast<long>(nn * sizeof(T));
+        std::allocator<T>().deallocate(ptr, nn);
+    }
+
+    template<typename U>
+    bool operator==(const CountingAlloc<U>&) const noexcept {
+        return true;
+    }
+};
+
 int main() {
     std::cout << "Testing Heap..." << std::endl;
     Heap<int> maxHeap;
@@ -41,5 +152,350 @@ int main() {
     minHeap.pop();
     assert(minHeap.top() == 10);
     std::cout << "Heap tests passed!" << std::endl;
+
+    std::cout << "Testing parallel partition..." << std::endl;
+    mySTL::parallel::setConcurrency(4);
+    Array<int> values;
+    for (int i = 0; i < 100000; ++i) {
+        values.pushBack(i);
+    }
+    auto isEven = [](const int x) { return x % 2 == 0; };
+    auto isSmall = [](const int x) { return x < 60000; };
+    assert(mySTL::parallel::partition(values, [](int) { return true; }) == values.end());
+    assert(mySTL::parallel::partition(values, [](int) { return false; }) == values.begin());
+    assert(mySTL::parallel::partition(values, isSmall) == values.begin() + 60000);
+    for (size_t i = 0; i < values.getSize(); ++i) {
+        assert(values[i] == static_cast<int>(i));
+    }
+    auto split = mySTL::parallel::partition(values, isEven);
+    assert(split == values.begin() + 50000);
+    assert(std::all_of(values.begin(), split, isEven));
+    assert(std::none_of(split, values.end(), isEven));
+    std::cout << "Parallel partition tests passed!" << std::endl;
+
+    std::cout << "Testing ConcurrentStack..." << std::endl;
+    stressConcurrentStack<false>(4, 4, 20000);
+    stressConcurrentStack<true>(4, 4, 20000);
+    stressConcurrentStack<true>(8, 2, 5000);
+    std::cout << "ConcurrentStack tests passed!" << std::endl;
+
+    std::cout << "Testing UnrolledList..." << std::endl;
+    // Four elements per block, so [1 2 3 4][5 6 7 8] puts a block boundary between 4 and 5.
+    using SmallList = UnrolledList<int, std::allocator<int>, 4>;
+    SmallList blocks;
+    for (int i = 1; i <= 8; ++i) {
+        blocks.pushBack(i);
+    }
+    auto at = [](SmallList& list, const int index) { return std::next(list.begin(), index); };
+    assert(*blocks.insert(at(blocks, 4), 100) == 100);
+    assert(contents(blocks) == std::vector<int>({1, 2, 3, 4, 100, 5, 6, 7, 8}));
+    assert(*blocks.insert(at(blocks, 2), 200) == 200);
+    assert(contents(blocks) == std::vector<int>({1, 2, 200, 3, 4, 100, 5, 6, 7, 8}));
+    blocks.insert(blocks.end(), 9);
+    blocks.insert(blocks.begin(), 0);
+    assert(contents(blocks) == std::vector<int>({0, 1, 2, 200, 3, 4, 100, 5, 6, 7, 8, 9}));
+    assert(*blocks.erase(at(blocks, 6)) == 5);
+    assert(*blocks.erase(at(blocks, 3)) == 3);
+    assert(blocks.erase(at(blocks, 9)) == blocks.end());
+    assert(contents(blocks) == std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8}));
+    for (auto it = blocks.begin(); it != blocks.end();) {
+        it = *it % 2 ? blocks.erase(it) : std::next(it);
+    }
+    assert(contents(blocks) == std::vector<int>({0, 2, 4, 6, 8}));
+    while (!blocks.empty()) {
+        blocks.erase(at(blocks, static_cast<int>(blocks.length() / 2)));
+    }
+    assert(blocks.begin() == blocks.end());
+
+    SmallList within;
+    for (int i = 0; i < 20; ++i) {
+        within.pushBack(i);
+    }
+    within.splice(at(within, 2), within, at(within, 10), at(within, 15));
+    assert(contents(within) == std::vector<int>({0, 1, 10, 11, 12, 13, 14, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 18, 19}));
+    within.splice(within.end(), within, at(within, 1), at(within, 3));
+    assert(contents(within) == std::vector<int>({0, 11, 12, 13, 14, 2, 3, 4, 5, 6, 7, 8, 9, 15, 16, 17, 18, 19, 1, 10}));
+    SmallList from;
+    for (int i = 100; i < 110; ++i) {
+        from.pushBack(i);
+    }
+    SmallList into;
+    into.pushBack(0);
+    into.pushBack(1);
+    into.pushBack(2);
+    into.splice(at(into, 1), from, at(from, 3), at(from, 9));
+    assert(contents(into) == std::vector<int>({0, 103, 104, 105, 106, 107, 108, 1, 2}));
+    assert(contents(from) == std::vector<int>({100, 101, 102, 109}));
+    into.splice(into.end(), from);
+    assert(from.empty() && from.begin() == from.end());
+    assert(contents(into) == std::vector<int>({0, 103, 104, 105, 106, 107, 108, 1, 2, 100, 101, 102, 109}));
+
+    auto byKey = [](const Tagged& left, const Tagged& right) { return left.key < right.key; };
+    UnrolledList<Tagged, std::allocator<Tagged>, 4> tagged;
+    for (int i = 0; i < 50; ++i) {
+        tagged.pushBack({(i * 7) % 5, i});
+    }
+    tagged.sort(byKey);
+    auto ordered = [](const std::vector<Tagged>& items) {
+        for (size_t i = 1; i < items.size(); ++i) {
+            if (items[i - 1].key > items[i].key || (items[i - 1].key == items[i].key && items[i - 1].tag > items[i].tag)) {
+                return false;
+            }
+        }
+        return true;
+    };
+    assert(ordered(contents(tagged)));
+    UnrolledList<Tagged, std::allocator<Tagged>, 4> left, right;
+    for (int i = 0; i < 12; ++i) {
+        left.pushBack({i / 3, i});
+        right.pushBack({i / 4, 100 + i});
+    }
+    left.merge(right, byKey);
+    assert(right.empty() && left.length() == 24);
+    const std::vector<Tagged> merged = contents(left);
+    assert(std::is_sorted(merged.begin(), merged.end(), byKey));
+    for (size_t i = 1; i < merged.size(); ++i) {
+        // Among equal keys, everything from `left` comes before anything from `right`.
+        assert(merged[i - 1].key != merged[i].key || merged[i - 1].tag < 100 || merged[i].tag >= 100);
+        assert(merged[i - 1].key != merged[i].key || merged[i - 1].tag < merged[i].tag);
+    }
+    std::cout << "UnrolledList tests passed!" << std::endl;
+
+    std::cout << "Testing PersistentHash..." << std::endl;
+    PersistentHash<int, int> persistent;
+    for (int i = 0; i < 1000; ++i) {
+        assert(persistent.insert(i, i));
+    }
+    auto before = persistent.snapshot();
+    for (int i = 0; i < 500; ++i) {
+        assert(!persistent.insert(i, -1));
+        assert(!persistent.insertOrAssign(i, i + 10000));
+    }
+    for (int i = 500; i < 1000; ++i) {
+        assert(persistent.erase(i) == 1);
+    }
+    for (int i = 1000; i < 2000; ++i) {
+        persistent.insert(i, i);
+    }
+    auto after = persistent.snapshot();
+    persistent.clear();
+    assert(persistent.isEmpty() && !persistent.contains(0));
+    assert(before.getSize() == 1000 && after.getSize() == 1500);
+    size_t seen = 0;
+    before.forEach([&](const int key, const int value) {
+        assert(key == value && key >= 0 && key < 1000);
+        ++seen;
+    });
+    assert(seen == 1000);
+    for (int i = 0; i < 2000; ++i) {
+        assert(before.contains(i) == (i < 1000));
+        assert(after.contains(i) == (i < 500 || i >= 1000));
+    }
+    assert(before.get(7) == 7 && after.get(7) == 10007 && after.get(1500) == 1500);
+
+    // Keys equal mod 4 share the full 64-bit hash, so they end up in one collision node.
+    PersistentHash<int, int, PrefixHash> colliding;
+    for (int i = 0; i < 40; ++i) {
+        colliding.insert(i, i);
+    }
+    auto collided = colliding.snapshot();
+    for (int i = 0; i < 40; i += 2) {
+        assert(colliding.erase(i) == 1);
+        colliding.insertOrAssign(i + 1, -i);
+    }
+    assert(colliding.getSize() == 20 && colliding.erase(0) == 0);
+    for (int i = 0; i < 40; ++i) {
+        assert(collided.get(i) == i);
+        assert(colliding.contains(i) == (i % 2 == 1));
+    }
+    assert(colliding.get(13) == -12);
+    for (int i = 1; i < 39; i += 2) {
+        colliding.erase(i);
+    }
+    assert(colliding.getSize() == 1 && colliding.get(39) == -38);
+
+    // Keys 1 and 2 only split at the ninth level; erasing one must fold the eight single-child
+    // branches above the survivor away, leaving exactly what inserting the survivor alone builds.
+    using Counted = PersistentHash<int, int, PrefixHash, std::equal_to<>, CountingAlloc<mySTL::containers::detail::KeyValue<const int, int>>>;
+    long alone;
+    {
+        Counted single;
+        single.insert(1, 1);
+        alone = countedBytes;
+    }
+    assert(countedBytes == 0);
+    {
+        Counted deep;
+        deep.insert(1, 1);
+        deep.insert(2, 2);
+        assert(countedBytes > alone);
+        {
+            auto pinned = deep.snapshot();
+            deep.erase(2);
+            assert(pinned.contains(2) && !deep.contains(2));
+        }
+        assert(countedBytes == alone && deep.get(1) == 1);
+        deep.erase(1);
+        assert(countedBytes == 0 && deep.isEmpty());
+    }
+    std::cout << "PersistentHash tests passed!" << std::endl;
+
+    std::cout << "Testing FlatHash..." << std::endl;
+    // 32 slots in two groups: keys 0..15 fill group 0, so keys 16..19 overflow into group 1.
+    FlatHash<int, int, IdentityHash> flat(20);
+    assert(flat.getBucketCount() == 32);
+    for (int i = 0; i < 20; ++i) {
+        flat.insert({i, i});
+    }
+    // Group 0 has no empty slot, so erasing there must leave a tombstone that keeps the probe for
+    // 16..19 going; group 1 still has empty slots, so erasing there frees the slot outright.
+    assert(flat.erase(3) == 1 && flat.erase(17) == 1);
+    assert(!flat.contains(3) && !flat.contains(17));
+    for (const int key : {0, 15, 16, 18, 19}) {
+        assert(flat.contains(key) && flat.get(key) == key);
+    }
+    assert(flat.insert({3, 30}).second && flat.insert({17, 170}).second);
+    assert(flat.getBucketCount() == 32 && flat.getSize() == 20 && flat.get(3) == 30);
+    // Churn that leaves tombstones behind is cleaned up by rebuilding at the same size.
+    for (int round = 0; round < 1000; ++round) {
+        flat.insert({100 + round % 28, round});
+        flat.erase(100 + round % 28);
+    }
+    assert(flat.getBucketCount() == 32 && flat.getSize() == 20);
+
+    FlatHash<int, int> grown;
+    for (int i = 0; i < 1000; ++i) {
+        grown.insert({i, i * 2});
+    }
+    const size_t grownBuckets = grown.getBucketCount();
+    assert(grownBuckets >= 1000 && (grownBuckets & (grownBuckets - 1)) == 0);
+    grown.rehash(5000);
+    assert(grown.getBucketCount() == 8192);
+    grown.rehash(1);
+    assert(grown.getBucketCount() == grownBuckets && grown.getSize() == 1000);
+    for (int i = 0; i < 1000; ++i) {
+        assert(grown.get(i) == i * 2);
+    }
+    size_t visited = 0;
+    for (auto it = grown.begin(); it != grown.end();) {
+        ++visited;
+        it = it->first % 2 == 0 ? grown.erase(it) : std::next(it);
+    }
+    assert(visited == 1000 && grown.getSize() == 500);
+    for (int i = 0; i < 1000; ++i) {
+        assert(grown.contains(i) == (i % 2 == 1));
+    }
+    assert(static_cast<size_t>(std::distance(grown.begin(), grown.end())) == 500);
+    std::cout << "FlatHash tests passed!" << std::endl;
+
+    std::cout << "Testing incremental rehash..." << std::endl;
+    // Grown to 4096 buckets in one go; the next insert with incremental rehash on starts moving
+    // them to 8192, a few buckets per insert or erase, while the checks below run against both.
+    Hash<int, int> rolling;
+    std::vector<bool> present(20000, false);
+    int nextKey = 0;
+    for ( ; nextKey < 4096; ++nextKey) {
+        rolling.insert({nextKey, nextKey * 3});
+        present[nextKey] = true;
+    }
+    assert(rolling.getBucketCount() == 4096);
+    rolling.setIncrementalRehash(true);
+    auto verify = [&present](const Hash<int, int>& table) {
+        std::vector<bool> seen(present.size(), false);
+        size_t count = 0;
+        for (const auto& entry : table) {
+            assert(present[entry.first] && !seen[entry.first] && entry.second == entry.first * 3);
+            seen[entry.first] = true;
+            ++count;
+        }
+        assert(count == table.getSize());
+        for (int key = 0; key < static_cast<int>(present.size()); ++key) {
+            assert(table.contains(key) == present[key]);
+        }
+    };
+    size_t checkedWhileMigrating = 0;
+    bool copied = false;
+    for (int step = 0; step == 0 || rolling.isRehashing(); ++step) {
+        rolling.insert({nextKey, nextKey * 3});
+        present[nextKey++] = true;
+        if (step % 3 == 2) {
+            const int victim = (step * 7) % nextKey;
+            assert(rolling.erase(victim) == (present[victim] ? 1u : 0u));
+            present[victim] = false;
+        }
+        if (step % 50 == 25) {
+            const int moved = step % nextKey;
+            auto handle = rolling.extract(moved);
+            assert(static_cast<bool>(handle) == present[moved]);
+            if (handle) {
+                assert(handle.key() == moved && handle.mapped() == moved * 3);
+                assert(rolling.insert(std::move(handle)).second && !handle);
+            }
+        }
+        if (step % 100 == 0 && rolling.isRehashing()) {
+            assert(rolling.getBucketCount() == 8192);
+            verify(rolling);
+            ++checkedWhileMigrating;
+        }
+        if (step == 700) {
+            assert(rolling.isRehashing());
+            Hash<int, int> copy(rolling);
+            verify(copy);
+            copy.insert({19999, 19999 * 3});
+            copy.erase(nextKey - 1);
+            assert(rolling.contains(nextKey - 1) && !rolling.contains(19999));
+            copied = true;
+        }
+    }
+    assert(copied && checkedWhileMigrating > 10);
+    assert(rolling.getBucketCount() == 8192);
+    verify(rolling);
+    std::cout << "Incremental rehash tests passed!" << std::endl;
+
+    std::cout << "Testing Hash node handles..." << std::endl;
+    Hash<int, int> donor, receiver;
+    for (int i = 0; i < 100; ++i) {
+        donor.insert({i, i});
+    }
+    for (int i = 50; i < 60; ++i) {
+        receiver.insert({i, -i});
+    }
+    auto node = donor.extract(7);
+    assert(node && node.key() == 7 && node.mapped() == 7 && !donor.contains(7) && donor.getSize() == 99);
+    node.mapped() = 70;
+    const int* linked = &node.mapped();
+    auto placed = receiver.insert(std::move(node));
+    assert(placed.second && !node && placed.first->second == 70 && &placed.first->second == linked);
+    assert(!donor.extract(7));
+    auto clash = donor.extract(donor.find(55));
+    assert(clash && !receiver.insert(std::move(clash)).second);
+    assert(clash && clash.key() == 55 && receiver.get(55) == -55);
+    assert(donor.insert(std::move(clash)).second);
+    receiver.merge(donor);
+    // Keys 50..59 were already in `receiver`, so those entries stay behind in `donor`.
+    assert(receiver.getSize() == 100 && donor.getSize() == 10);
+    for (int i = 0; i < 100; ++i) {
+        assert(receiver.get(i) == (i == 7 ? 70 : i >= 50 && i < 60 ? -i : i));
+        assert(donor.contains(i) == (i >= 50 && i < 60));
+    }
+    receiver.merge(std::move(donor));
+    assert(receiver.getSize() == 100 && donor.getSize() == 10);
+    std::cout << "Hash node handle tests passed!" << std::endl;
+
+    std::cout << "Testing Hasher..." << std::endl;
+    // The test vectors published with wyhash final version 4: message i hashed with seed i.
+    const char* messages[] = {
+        "", "a", "abc", "message digest", "abcdefghijklmnopqrstuvwxyz",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+        "12345678901234567890123456789012345678901234567890123456789012345678901234567890"
+    };
+    const std::uint64_t expected[] = {
+        0x93228a4de0eec5a2ull, 0xc5bac3db178713c4ull, 0xa97f2f7b1d9b3314ull, 0x786d1f1df3801df4ull,
+        0xdca5a8138ad37c87ull, 0xb9e734f117cfaf70ull, 0x6cc5eab49a92d617ull
+    };
+    for (std::uint64_t i = 0; i < 7; ++i) {
+        assert(mySTL::hash::hashBytes(std::string_view(messages[i]), i) == expected[i]);
+    }
+    std::cout << "Hasher tests passed!" << std::endl;
     return 0;
 }